@@ -766,6 +766,14 @@ def addSEOptions(parser):
         action="store_true",
         help="Wait for remote GDB to connect.",
     )
+    parser.add_argument(
+        "--parallel-processes",
+        default=False,
+        action="store_true",
+        help="Simulate the CPUs running different processes on their own "
+        "event queues (host threads), synchronized every millisecond of "
+        "simulated time. Only supported with KVM CPUs, without caches.",
+    )
 
 
 def addFSOptions(parser):
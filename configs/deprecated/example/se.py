@@ -295,4 +295,24 @@ if args.wait_gdb:
     system.workload.wait_for_remote_gdb = True
 
 root = Root(full_system=False, system=system)
+
+if args.parallel_processes:
+    # The memory system isn't thread-safe: even atomic accesses update
+    # the crossbar, snoop filter and memory state shared by all CPUs.
+    # KVM CPUs access guest memory directly and only use the memory
+    # system for functional accesses, which leave it untouched.
+    if not ObjectList.is_kvm_cpu(CPUClass):
+        fatal("Parallel processes need KVM CPUs")
+    if args.caches or args.l2cache or args.ruby:
+        fatal("Parallel processes don't support caches")
+    if args.smt or len(multiprocesses) != np:
+        fatal("Parallel processes need one process per CPU")
+    # Every CPU gets its own event queue, while caches, memories and
+    # other child objects share the first one.
+    for i, cpu in enumerate(system.cpu):
+        for obj in cpu.descendants():
+            obj.eventq_index = 0
+        cpu.eventq_index = i + 1
+    root.sim_quantum = int(1e9)  # 1 ms
+
 Simulation.run(args, root, system, FutureClass)
@@ -0,0 +1,127 @@
+# Copyright (c) 2026 The gem5 Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+This gem5 configuration script measures the throughput of the X86 decoder
+on a real binary. The binary is run in SE mode on a single atomic CPU
+without caches, so that the host time is dominated by fetch, decode and
+execute rather than by the memory system.
+
+The host time and instruction rate are printed at the end of the run. The
+decoder statistics of the core in stats.txt (addrCacheHits, byteCacheHits
+and fullDecodes) break the decoded instructions down into the ones found
+in the decode cache by address, the ones found by their raw bytes, and the
+ones decoded by the decoder state machine.
+
+Usage
+-----
+
+```
+scons build/X86/gem5.opt
+./build/X86/gem5.opt configs/example/gem5_library/x86-decoder-benchmark.py \
+    [--binary /path/to/x86/binary] [--arguments arg0 arg1 ...]
+```
+
+When no binary is given, the "x86-hello64-static" resource is used.
+"""
+
+import argparse
+import time
+
+from gem5.components.boards.simple_board import SimpleBoard
+from gem5.components.cachehierarchies.classic.no_cache import NoCache
+from gem5.components.memory import SingleChannelDDR3_1600
+from gem5.components.processors.cpu_types import CPUTypes
+from gem5.components.processors.simple_processor import SimpleProcessor
+from gem5.isas import ISA
+from gem5.resources.resource import (
+    BinaryResource,
+    obtain_resource,
+)
+from gem5.simulate.simulator import Simulator
+from gem5.utils.requires import requires
+
+parser = argparse.ArgumentParser(
+    description="Measure the X86 decoder throughput on an SE mode binary."
+)
+
+parser.add_argument(
+    "--binary",
+    type=str,
+    default=None,
+    help="Path to the X86 binary to run (x86-hello64-static by default).",
+)
+
+parser.add_argument(
+    "--arguments",
+    type=str,
+    nargs="*",
+    default=[],
+    help="Arguments passed to the binary.",
+)
+
+args = parser.parse_args()
+
+requires(isa_required=ISA.X86)
+
+cache_hierarchy = NoCache()
+
+memory = SingleChannelDDR3_1600(size="3GB")
+
+processor = SimpleProcessor(
+    cpu_type=CPUTypes.ATOMIC, isa=ISA.X86, num_cores=1
+)
+
+board = SimpleBoard(
+    clk_freq="3GHz",
+    processor=processor,
+    memory=memory,
+    cache_hierarchy=cache_hierarchy,
+)
+
+if args.binary:
+    binary = BinaryResource(local_path=args.binary)
+else:
+    binary = obtain_resource("x86-hello64-static")
+
+board.set_se_binary_workload(binary, arguments=args.arguments)
+
+simulator = Simulator(board=board)
+
+start = time.perf_counter()
+simulator.run()
+host_seconds = time.perf_counter() - start
+
+insts = processor.get_cores()[0].get_simobject().totalInsts()
+
+print(
+    "Exiting @ tick {} because {}.".format(
+        simulator.get_current_tick(), simulator.get_last_exit_event_cause()
+    )
+)
+print(f"Host seconds: {host_seconds:.3f}")
+print(f"Instructions: {insts}")
+print(f"Instruction rate: {insts / host_seconds:.0f} inst/s")
@@ -35,6 +35,7 @@
 #include <cmath>
 
 #include "arch/amdgpu/vega/gpu_registers.hh"
+#include "gpu-compute/misc.hh"
 
 namespace gem5
 {
@@ -295,6 +296,24 @@ namespace VegaISA
         return (VecElemU32)(result >> 64) ? 1 : 0;
     }
 
+    /**
+     * laneMask evaluates a condition for all the lanes of a wavefront, in a
+     * loop the compiler can vectorize, and returns the mask of the active
+     * lanes for which it holds, with the inactive lanes cleared. this is
+     * the result of the vector compare instructions.
+     */
+    template<typename Cond>
+    inline ScalarRegU64
+    laneMask(const VectorMask &exec_mask, Cond cond)
+    {
+        ScalarRegU64 mask = 0;
+        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+            mask |= (ScalarRegU64)(bool)cond(lane) << lane;
+        }
+
+        return mask & exec_mask.to_ullong();
+    }
+
     /**
      * dppInstImpl is a helper function that performs the inputted operation
      * on the inputted vector register lane.  The returned output lane
@@ -6107,10 +6107,12 @@ namespace VegaISA
                 }
             }
         } else {
+            const auto s0 = src0.lanes();
+            const auto s1 = src1.lanes();
+            auto d = vdst.lanes();
+
             for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] + src1[lane];
-                }
+                d[lane] = s0[lane] + s1[lane];
             }
         }
 
@@ -6135,7 +6137,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUB_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -6143,10 +6144,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
+            d[lane] = s0[lane] - s1[lane];
         }
 
         vdst.write();
@@ -6170,7 +6173,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUBREV_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -6178,10 +6180,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
+            d[lane] = s1[lane] - s0[lane];
         }
 
         vdst.write();
@@ -6204,7 +6208,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MUL_LEGACY_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -6212,10 +6215,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] * src1[lane];
-            }
+            d[lane] = s0[lane] * s1[lane];
         }
 
         vdst.write();
@@ -6453,7 +6458,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MIN_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -6461,10 +6465,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmin(src0[lane], src1[lane]);
-            }
+            d[lane] = std::fmin(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -6487,7 +6493,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MAX_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, instData.VSRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -6495,10 +6500,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmax(src0[lane], src1[lane]);
-            }
+            d[lane] = std::fmax(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -6520,7 +6527,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MIN_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandI32 src1(gpuDynInst, instData.VSRC1);
         VecOperandI32 vdst(gpuDynInst, instData.VDST);
@@ -6528,10 +6534,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
+            d[lane] = std::min(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -6553,7 +6561,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MAX_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandI32 src1(gpuDynInst, instData.VSRC1);
         VecOperandI32 vdst(gpuDynInst, instData.VDST);
@@ -6561,10 +6568,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
+            d[lane] = std::max(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -6586,7 +6595,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MIN_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -6594,10 +6602,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
+            d[lane] = std::min(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -6619,7 +6629,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MAX_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -6627,10 +6636,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
+            d[lane] = std::max(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -6654,7 +6665,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_LSHRREV_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -6662,10 +6672,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 4, 0);
-            }
+            d[lane] = s1[lane] >> bits(s0[lane], 4, 0);
         }
 
         vdst.write();
@@ -6689,7 +6701,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_ASHRREV_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandI32 src1(gpuDynInst, instData.VSRC1);
         VecOperandI32 vdst(gpuDynInst, instData.VDST);
@@ -6697,10 +6708,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 4, 0);
-            }
+            d[lane] = s1[lane] >> bits(s0[lane], 4, 0);
         }
 
         vdst.write();
@@ -6771,10 +6784,12 @@ namespace VegaISA
 
             processSDWA_dst(extData.iFmt_VOP_SDWA, vdst, origVdst);
         } else {
+            const auto s0 = src0.lanes();
+            const auto s1 = src1.lanes();
+            auto d = vdst.lanes();
+
             for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src1[lane] << bits(src0[lane], 4, 0);
-                }
+                d[lane] = s1[lane] << bits(s0[lane], 4, 0);
             }
         }
 
@@ -6831,10 +6846,12 @@ namespace VegaISA
                 }
             }
         } else {
+            const auto s0 = src0.lanes();
+            const auto s1 = src1.lanes();
+            auto d = vdst.lanes();
+
             for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] & src1[lane];
-                }
+                d[lane] = s0[lane] & s1[lane];
             }
         }
 
@@ -6906,10 +6923,12 @@ namespace VegaISA
 
             processSDWA_dst(extData.iFmt_VOP_SDWA, vdst, origVdst);
         } else {
+            const auto s0 = src0.lanes();
+            const auto s1 = src1.lanes();
+            auto d = vdst.lanes();
+
             for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] | src1[lane];
-                }
+                d[lane] = s0[lane] | s1[lane];
             }
         }
 
@@ -6933,7 +6952,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_XOR_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -6941,10 +6959,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] ^ src1[lane];
-            }
+            d[lane] = s0[lane] ^ s1[lane];
         }
 
         vdst.write();
@@ -7004,10 +7024,12 @@ namespace VegaISA
                 }
             }
         } else {
+            const auto s0 = src0.lanes();
+            const auto s1 = src1.lanes();
+            auto d = vdst.lanes();
+
             for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = std::fma(src0[lane], src1[lane], vdst[lane]);
-                }
+                d[lane] = std::fma(s0[lane], s1[lane], d[lane]);
             }
         }
 
@@ -7570,7 +7592,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_ADD_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -7578,10 +7599,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
+            d[lane] = s0[lane] + s1[lane];
         }
 
         vdst.write();
@@ -7604,7 +7627,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUB_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -7612,10 +7634,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
+            d[lane] = s0[lane] - s1[lane];
         }
 
         vdst.write();
@@ -7639,7 +7663,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUBREV_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -7647,10 +7670,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
+            d[lane] = s1[lane] - s0[lane];
         }
 
         vdst.write();
@@ -7707,7 +7732,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_LSHLREV_B16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -7715,10 +7739,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] << bits(src0[lane], 3, 0);
-            }
+            d[lane] = s1[lane] << bits(s0[lane], 3, 0);
         }
 
         vdst.write();
@@ -7854,7 +7880,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MAX_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -7862,10 +7887,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
+            d[lane] = std::max(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -7887,7 +7914,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MAX_I16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandI16 src1(gpuDynInst, instData.VSRC1);
         VecOperandI16 vdst(gpuDynInst, instData.VDST);
@@ -7895,10 +7921,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
+            d[lane] = std::max(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -7920,7 +7948,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MIN_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, instData.VSRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -7928,10 +7955,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
+            d[lane] = std::min(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -7953,7 +7982,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_MIN_I16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI16 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandI16 src1(gpuDynInst, instData.VSRC1);
         VecOperandI16 vdst(gpuDynInst, instData.VDST);
@@ -7961,10 +7989,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
+            d[lane] = std::min(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -8054,10 +8084,12 @@ namespace VegaISA
 
             processSDWA_dst(extData.iFmt_VOP_SDWA, vdst, origVdst);
         } else {
+            const auto s0 = src0.lanes();
+            const auto s1 = src1.lanes();
+            auto d = vdst.lanes();
+
             for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src0[lane] + src1[lane];
-                }
+                d[lane] = s0[lane] + s1[lane];
             }
         }
 
@@ -8080,7 +8112,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUB_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -8088,10 +8119,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
+            d[lane] = s0[lane] - s1[lane];
         }
 
         vdst.write();
@@ -8113,7 +8146,6 @@ namespace VegaISA
     void
     Inst_VOP2__V_SUBREV_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, instData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, instData.VSRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -8121,10 +8153,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
+            d[lane] = s1[lane] - s0[lane];
         }
 
         vdst.write();
@@ -8201,10 +8235,11 @@ namespace VegaISA
                 }
             }
         } else {
+            const auto s = src.lanes();
+            auto d = vdst.lanes();
+
             for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                if (wf->execMask(lane)) {
-                    vdst[lane] = src[lane];
-                }
+                d[lane] = s[lane];
             }
         }
 
@@ -8312,16 +8347,16 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F64_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src(gpuDynInst, instData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
         src.readSrc();
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
+            d[lane] = (VecElemF64)s[lane];
         }
 
         vdst.write();
@@ -8344,16 +8379,16 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F32_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
         src.readSrc();
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
+            d[lane] = (VecElemF32)s[lane];
         }
 
         vdst.write();
@@ -8376,16 +8411,16 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F32_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
         src.readSrc();
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
+            d[lane] = (VecElemF32)s[lane];
         }
 
         vdst.write();
@@ -8653,16 +8688,16 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F32_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
         src.readSrc();
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
+            d[lane] = (VecElemF32)s[lane];
         }
 
         vdst.write();
@@ -8685,16 +8720,16 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F64_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, instData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
         src.readSrc();
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
+            d[lane] = (VecElemF64)s[lane];
         }
 
         vdst.write();
@@ -8893,16 +8928,16 @@ namespace VegaISA
     void
     Inst_VOP1__V_CVT_F64_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, instData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
         src.readSrc();
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
+            d[lane] = (VecElemF64)s[lane];
         }
 
         vdst.write();
@@ -8925,16 +8960,16 @@ namespace VegaISA
     void
     Inst_VOP1__V_TRUNC_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src(gpuDynInst, instData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
         src.readSrc();
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::trunc(src[lane]);
-            }
+            d[lane] = std::trunc(s[lane]);
         }
 
         vdst.write();
@@ -8958,16 +8993,16 @@ namespace VegaISA
     void
     Inst_VOP1__V_CEIL_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src(gpuDynInst, instData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
         src.readSrc();
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::ceil(src[lane]);
-            }
+            d[lane] = std::ceil(s[lane]);
         }
 
         vdst.write();
@@ -9023,16 +9058,16 @@ namespace VegaISA
     void
     Inst_VOP1__V_FLOOR_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src(gpuDynInst, instData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
         src.readSrc();
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::floor(src[lane]);
-            }
+            d[lane] = std::floor(s[lane]);
         }
 
         vdst.write();
@@ -9121,16 +9156,16 @@ namespace VegaISA
     void
     Inst_VOP1__V_CEIL_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
         src.readSrc();
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::ceil(src[lane]);
-            }
+            d[lane] = std::ceil(s[lane]);
         }
 
         vdst.write();
@@ -9186,16 +9221,16 @@ namespace VegaISA
     void
     Inst_VOP1__V_FLOOR_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, instData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
         src.readSrc();
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::floor(src[lane]);
-            }
+            d[lane] = std::floor(s[lane]);
         }
 
         vdst.write();
@@ -9611,16 +9646,16 @@ namespace VegaISA
     void
     Inst_VOP1__V_NOT_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, instData.SRC0);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
 
         src.readSrc();
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = ~src[lane];
-            }
+            d[lane] = ~s[lane];
         }
 
         vdst.write();
@@ -11669,11 +11704,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -11703,11 +11739,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -11737,11 +11774,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -11771,11 +11809,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -11805,12 +11844,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return (s0[lane] < s1[lane] || s0[lane] > s1[lane]);
+        });
 
         vcc.write();
     } // execute
@@ -11840,11 +11879,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -11874,12 +11914,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return (!std::isnan(s0[lane]) && !std::isnan(s1[lane]));
+        });
 
         vcc.write();
     } // execute
@@ -11909,12 +11949,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return (std::isnan(s0[lane]) || std::isnan(s1[lane]));
+        });
 
         vcc.write();
     } // execute
@@ -11944,11 +11984,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] >= s1[lane]);
+        });
 
         vcc.write();
     } // execute
@@ -11978,12 +12019,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] < s1[lane] || s0[lane] > s1[lane]);
+        });
 
         vcc.write();
     } // execute
@@ -12013,11 +12054,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] > s1[lane]);
+        });
 
         vcc.write();
     } // execute
@@ -12047,11 +12089,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] <= s1[lane]);
+        });
 
         vcc.write();
     } // execute
@@ -12081,11 +12124,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -12115,11 +12159,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] < s1[lane]);
+        });
 
         vcc.write();
     } // execute
@@ -12210,11 +12255,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12246,11 +12292,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12282,11 +12329,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12318,11 +12366,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12354,12 +12403,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return (s0[lane] < s1[lane] || s0[lane] > s1[lane]);
+        });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12391,11 +12440,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12428,12 +12478,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return (!std::isnan(s0[lane]) && !std::isnan(s1[lane]));
+        });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12466,12 +12516,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return (std::isnan(s0[lane]) || std::isnan(s1[lane]));
+        });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12503,11 +12553,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] >= s1[lane]);
+        });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12539,12 +12590,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] < s1[lane] || s0[lane] > s1[lane]);
+        });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12576,11 +12627,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] > s1[lane]);
+        });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12612,11 +12664,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] <= s1[lane]);
+        });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12648,11 +12701,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] == src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] == s1[lane]);
+        });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12684,11 +12738,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] < s1[lane]);
+        });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -12779,11 +12834,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -12813,11 +12869,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -12847,11 +12904,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -12881,11 +12939,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -12915,12 +12974,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return (s0[lane] < s1[lane] || s0[lane] > s1[lane]);
+        });
 
         vcc.write();
     } // execute
@@ -12950,11 +13009,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -12984,12 +13044,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return (!std::isnan(s0[lane]) && !std::isnan(s1[lane]));
+        });
 
         vcc.write();
     } // execute
@@ -13019,12 +13079,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return (std::isnan(s0[lane]) || std::isnan(s1[lane]));
+        });
 
         vcc.write();
     } // execute
@@ -13054,11 +13114,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] >= s1[lane]);
+        });
 
         vcc.write();
     } // execute
@@ -13088,12 +13149,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] < s1[lane] || s0[lane] > s1[lane]);
+        });
 
         vcc.write();
     } // execute
@@ -13123,11 +13184,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] > s1[lane]);
+        });
 
         vcc.write();
     } // execute
@@ -13157,11 +13219,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] <= s1[lane]);
+        });
 
         vcc.write();
     } // execute
@@ -13191,11 +13254,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -13225,11 +13289,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] < s1[lane]);
+        });
 
         vcc.write();
     } // execute
@@ -13320,11 +13385,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -13356,11 +13422,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         vcc.write();
         wf->execMask() = vcc.rawData();
@@ -13392,11 +13459,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13428,11 +13496,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13464,12 +13533,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return (s0[lane] < s1[lane] || s0[lane] > s1[lane]);
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13501,11 +13570,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13538,12 +13608,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return (!std::isnan(s0[lane]) && !std::isnan(s1[lane]));
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13576,12 +13646,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return (std::isnan(s0[lane]) || std::isnan(s1[lane]));
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13613,11 +13683,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] >= s1[lane]);
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13649,12 +13720,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] < s1[lane] || s0[lane] > s1[lane]);
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13686,11 +13757,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] > s1[lane]);
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13722,11 +13794,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] <= s1[lane]);
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13758,11 +13831,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13794,11 +13868,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] < s1[lane]);
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -13887,11 +13962,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -13920,11 +13996,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -13953,11 +14030,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -13986,11 +14064,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -14019,11 +14098,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -14052,11 +14132,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -14141,11 +14222,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -14174,11 +14256,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -14207,11 +14290,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -14240,11 +14324,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -14273,11 +14358,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -14306,11 +14392,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -14398,11 +14485,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14433,11 +14521,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14468,11 +14557,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14503,11 +14593,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14538,11 +14629,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14573,11 +14665,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14668,11 +14761,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14703,11 +14797,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14738,11 +14833,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14773,11 +14869,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14808,11 +14905,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14843,11 +14941,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -14935,11 +15034,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -14968,11 +15068,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -15001,11 +15102,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -15034,11 +15136,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -15067,11 +15170,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -15100,11 +15204,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -15189,11 +15294,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -15222,11 +15328,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -15255,11 +15362,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -15288,11 +15396,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -15321,11 +15430,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -15354,11 +15464,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -15446,11 +15557,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15481,11 +15593,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15516,11 +15629,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15551,11 +15665,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15586,11 +15701,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15621,11 +15737,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15716,11 +15833,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15751,11 +15869,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15786,11 +15905,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15821,11 +15941,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15856,11 +15977,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15891,11 +16013,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -15983,11 +16106,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -16016,11 +16140,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -16049,11 +16174,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -16080,13 +16206,14 @@ namespace VegaISA
         ScalarOperandU64 vcc(gpuDynInst, REG_VCC_LO);
 
         src0.readSrc();
-        src1.read();
-
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        src1.read();
+
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -16115,11 +16242,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -16148,11 +16276,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -16237,11 +16366,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -16270,11 +16400,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -16303,11 +16434,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -16336,11 +16468,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -16369,11 +16502,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -16402,11 +16536,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         vcc.write();
     } // execute
@@ -16494,11 +16629,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16529,11 +16665,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16564,11 +16701,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16599,11 +16737,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16634,11 +16773,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16669,11 +16809,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16764,11 +16905,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16799,11 +16941,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16834,11 +16977,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16869,11 +17013,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16904,11 +17049,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -16939,11 +17085,12 @@ namespace VegaISA
         src0.readSrc();
         src1.read();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vcc.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        vcc = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         wf->execMask() = vcc.rawData();
         vcc.write();
@@ -18362,11 +18509,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -18397,11 +18545,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -18432,11 +18581,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -18467,11 +18617,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -18502,11 +18653,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -18537,11 +18689,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -18571,12 +18724,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return (!std::isnan(s0[lane]) && !std::isnan(s1[lane]));
+        });
 
         sdst.write();
     } // execute
@@ -18606,12 +18759,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return (std::isnan(s0[lane]) || std::isnan(s1[lane]));
+        });
 
         sdst.write();
     } // execute
@@ -18642,11 +18795,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] >= s1[lane]);
+        });
 
         sdst.write();
     } // execute
@@ -18677,12 +18831,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] < s1[lane] || s0[lane] > s1[lane]);
+        });
 
         sdst.write();
     } // execute
@@ -18713,11 +18867,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] > s1[lane]);
+        });
 
         sdst.write();
     } // execute
@@ -18748,11 +18903,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] <= s1[lane]);
+        });
 
         sdst.write();
     } // execute
@@ -18783,11 +18939,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -18818,11 +18975,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] < s1[lane]);
+        });
 
         sdst.write();
     } // execute
@@ -18916,11 +19074,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -18953,11 +19112,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -18990,11 +19150,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19027,11 +19188,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19064,12 +19226,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return (s0[lane] < s1[lane] || s0[lane] > s1[lane]);
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19102,11 +19264,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19140,12 +19303,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return (!std::isnan(s0[lane]) && !std::isnan(s1[lane]));
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19179,12 +19342,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (std::isnan(src0[lane])
-                        || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return (std::isnan(s0[lane]) || std::isnan(s1[lane]));
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19217,11 +19380,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] >= s1[lane]);
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19254,12 +19418,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] < s1[lane] || s0[lane] > s1[lane]);
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19292,11 +19456,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] > s1[lane]);
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19329,11 +19494,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] <= s1[lane]);
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19366,11 +19532,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19403,11 +19570,12 @@ namespace VegaISA
         src0.readSrc();
         src1.readSrc();
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] < s1[lane]);
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -19522,11 +19690,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -19579,12 +19748,13 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
-
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
+
         sdst.write();
     } // execute
     // --- Inst_VOP3__V_CMP_LE_F64 class methods ---
@@ -19636,11 +19806,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -19693,11 +19864,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -19750,12 +19922,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return (s0[lane] < s1[lane] || s0[lane] > s1[lane]);
+        });
 
         sdst.write();
     } // execute
@@ -19808,11 +19980,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -19864,12 +20037,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return (!std::isnan(s0[lane]) && !std::isnan(s1[lane]));
+        });
 
         sdst.write();
     } // execute
@@ -19921,12 +20094,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return (std::isnan(s0[lane]) || std::isnan(s1[lane]));
+        });
 
         sdst.write();
     } // execute
@@ -19979,11 +20152,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] >= s1[lane]);
+        });
 
         sdst.write();
     } // execute
@@ -20036,12 +20210,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] < s1[lane] || s0[lane] > s1[lane]);
+        });
 
         sdst.write();
     } // execute
@@ -20094,11 +20268,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] > s1[lane]);
+        });
 
         sdst.write();
     } // execute
@@ -20151,11 +20326,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] <= s1[lane]);
+        });
 
         sdst.write();
     } // execute
@@ -20208,11 +20384,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -20265,11 +20442,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] < s1[lane]);
+        });
 
         sdst.write();
     } // execute
@@ -20385,11 +20563,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20444,11 +20623,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20503,11 +20683,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20562,11 +20743,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20621,12 +20803,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return (s0[lane] < s1[lane] || s0[lane] > s1[lane]);
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20681,11 +20863,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20741,12 +20924,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (!std::isnan(src0[lane])
-                    && !std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return (!std::isnan(s0[lane]) && !std::isnan(s1[lane]));
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20802,12 +20985,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, (std::isnan(src0[lane])
-                    || std::isnan(src1[lane])) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return (std::isnan(s0[lane]) || std::isnan(s1[lane]));
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20862,11 +21045,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] >= src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] >= s1[lane]);
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20921,12 +21105,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]
-                    || src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] < s1[lane] || s0[lane] > s1[lane]);
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -20981,11 +21165,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] > src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] > s1[lane]);
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21040,11 +21225,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] <= src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] <= s1[lane]);
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21099,11 +21285,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21158,11 +21345,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, !(src0[lane] < src1[lane]) ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return !(s0[lane] < s1[lane]);
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21263,11 +21451,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -21307,11 +21496,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -21351,11 +21541,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -21395,11 +21586,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -21439,11 +21631,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -21483,11 +21676,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -21583,11 +21777,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -21627,11 +21822,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -21671,11 +21867,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -21715,11 +21912,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -21759,11 +21957,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -21803,11 +22002,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -21907,11 +22107,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21953,11 +22154,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -21999,11 +22201,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22045,11 +22248,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22091,11 +22295,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22137,11 +22342,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22245,11 +22451,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22291,11 +22498,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22337,11 +22545,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22383,11 +22592,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22429,11 +22639,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22475,11 +22686,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -22579,11 +22791,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -22623,11 +22836,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -22667,11 +22881,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -22711,11 +22926,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -22755,11 +22971,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -22799,11 +23016,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -22899,11 +23117,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -22943,11 +23162,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -22987,11 +23207,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -23031,11 +23252,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -23075,11 +23297,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -23119,11 +23342,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -23223,11 +23447,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23269,11 +23494,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23315,11 +23541,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23361,11 +23588,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23407,11 +23635,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23453,11 +23682,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23561,11 +23791,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23607,11 +23838,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23653,11 +23885,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23699,11 +23932,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23745,11 +23979,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23791,11 +24026,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -23895,11 +24131,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -23939,11 +24176,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -23983,11 +24221,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -24027,11 +24266,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -24071,11 +24311,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -24115,11 +24356,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -24215,11 +24457,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -24259,11 +24502,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -24303,11 +24547,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -24347,11 +24592,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -24391,11 +24637,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -24435,11 +24682,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         sdst.write();
     } // execute
@@ -24539,11 +24787,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -24585,11 +24834,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -24631,11 +24881,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -24677,11 +24928,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -24723,11 +24975,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -24769,11 +25022,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -24877,11 +25131,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] < src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] < s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -24923,11 +25178,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] == src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] == s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -24969,11 +25225,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] <= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] <= s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -25015,11 +25272,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] > src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] > s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -25061,11 +25319,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] != src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] != s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -25107,11 +25366,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
-        for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                sdst.setBit(lane, src0[lane] >= src1[lane] ? 1 : 0);
-            }
-        }
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+
+        sdst = laneMask(wf->execMask(), [&](int lane) {
+            return s0[lane] >= s1[lane];
+        });
 
         wf->execMask() = sdst.rawData();
         sdst.write();
@@ -25223,7 +25483,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_ADD_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -25253,10 +25512,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
+            d[lane] = s0[lane] + s1[lane];
         }
 
         vdst.write();
@@ -25280,7 +25541,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_SUB_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -25310,10 +25570,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
+            d[lane] = s0[lane] - s1[lane];
         }
 
         vdst.write();
@@ -25337,7 +25599,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_SUBREV_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -25367,10 +25628,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
+            d[lane] = s1[lane] - s0[lane];
         }
 
         vdst.write();
@@ -25686,7 +25949,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MUL_U32_U24::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -25704,10 +25966,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = bits(src0[lane], 23, 0) * bits(src1[lane], 23, 0);
-            }
+            d[lane] = bits(s0[lane], 23, 0) * bits(s1[lane], 23, 0);
         }
 
         vdst.write();
@@ -25775,7 +26039,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MIN_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -25805,10 +26068,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmin(src0[lane], src1[lane]);
-            }
+            d[lane] = std::fmin(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -25831,7 +26096,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAX_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -25861,10 +26125,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmax(src0[lane], src1[lane]);
-            }
+            d[lane] = std::fmax(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -25886,7 +26152,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MIN_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandI32 src1(gpuDynInst, extData.SRC1);
         VecOperandI32 vdst(gpuDynInst, instData.VDST);
@@ -25904,10 +26169,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
+            d[lane] = std::min(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -25929,7 +26196,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAX_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandI32 src1(gpuDynInst, extData.SRC1);
         VecOperandI32 vdst(gpuDynInst, instData.VDST);
@@ -25947,10 +26213,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
+            d[lane] = std::max(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -25972,7 +26240,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MIN_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -25990,10 +26257,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
+            d[lane] = std::min(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -26015,7 +26284,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAX_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -26033,10 +26301,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
+            d[lane] = std::max(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -26060,7 +26330,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_LSHRREV_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -26078,10 +26347,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 4, 0);
-            }
+            d[lane] = s1[lane] >> bits(s0[lane], 4, 0);
         }
 
         vdst.write();
@@ -26105,7 +26376,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_ASHRREV_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandI32 src1(gpuDynInst, extData.SRC1);
         VecOperandI32 vdst(gpuDynInst, instData.VDST);
@@ -26123,10 +26393,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 4, 0);
-            }
+            d[lane] = s1[lane] >> bits(s0[lane], 4, 0);
         }
 
         vdst.write();
@@ -26149,7 +26421,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_LSHLREV_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -26167,10 +26438,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] << bits(src0[lane], 4, 0);
-            }
+            d[lane] = s1[lane] << bits(s0[lane], 4, 0);
         }
 
         vdst.write();
@@ -26193,7 +26466,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_AND_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -26211,10 +26483,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] & src1[lane];
-            }
+            d[lane] = s0[lane] & s1[lane];
         }
 
         vdst.write();
@@ -26237,7 +26511,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_OR_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -26255,10 +26528,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] | src1[lane];
-            }
+            d[lane] = s0[lane] | s1[lane];
         }
 
         vdst.write();
@@ -26281,7 +26556,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_OR3_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU32 src2(gpuDynInst, extData.SRC2);
@@ -26301,10 +26575,13 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] | src1[lane] | src2[lane];
-            }
+            d[lane] = s0[lane] | s1[lane] | s2[lane];
         }
 
         vdst.write();
@@ -26327,7 +26604,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_XOR_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -26345,10 +26621,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] ^ src1[lane];
-            }
+            d[lane] = s0[lane] ^ s1[lane];
         }
 
         vdst.write();
@@ -26373,7 +26651,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAC_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
@@ -26404,10 +26681,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], vdst[lane]);
-            }
+            d[lane] = std::fma(s0[lane], s1[lane], d[lane]);
         }
 
         vdst.write();
@@ -26845,7 +27124,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_ADD_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, extData.SRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -26863,10 +27141,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
+            d[lane] = s0[lane] + s1[lane];
         }
 
         vdst.write();
@@ -26889,7 +27169,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_SUB_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, extData.SRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -26907,10 +27186,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
+            d[lane] = s0[lane] - s1[lane];
         }
 
         vdst.write();
@@ -26934,7 +27215,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_SUBREV_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, extData.SRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -26952,10 +27232,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
+            d[lane] = s1[lane] - s0[lane];
         }
 
         vdst.write();
@@ -27022,7 +27304,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_LSHLREV_B16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -27040,10 +27321,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] << bits(src0[lane], 3, 0);
-            }
+            d[lane] = s1[lane] << bits(s0[lane], 3, 0);
         }
 
         vdst.write();
@@ -27067,7 +27350,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_LSHRREV_B16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -27091,10 +27373,12 @@ namespace VegaISA
             src1.negModifier();
         }
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 3, 0);
-            }
+            d[lane] = s1[lane] >> bits(s0[lane], 3, 0);
         }
 
         vdst.write();
@@ -27118,7 +27402,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_ASHRREV_I16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandI16 src1(gpuDynInst, extData.SRC1);
         VecOperandI16 vdst(gpuDynInst, instData.VDST);
@@ -27136,10 +27419,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 3, 0);
-            }
+            d[lane] = s1[lane] >> bits(s0[lane], 3, 0);
         }
 
         vdst.write();
@@ -27205,7 +27490,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAX_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, extData.SRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -27229,10 +27513,12 @@ namespace VegaISA
             src1.negModifier();
         }
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
+            d[lane] = std::max(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -27254,7 +27540,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAX_I16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandI16 src1(gpuDynInst, extData.SRC1);
         VecOperandI16 vdst(gpuDynInst, instData.VDST);
@@ -27278,10 +27563,12 @@ namespace VegaISA
             src1.negModifier();
         }
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::max(src0[lane], src1[lane]);
-            }
+            d[lane] = std::max(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -27303,7 +27590,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MIN_U16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU16 src1(gpuDynInst, extData.SRC1);
         VecOperandU16 vdst(gpuDynInst, instData.VDST);
@@ -27327,10 +27613,12 @@ namespace VegaISA
             src1.negModifier();
         }
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
+            d[lane] = std::min(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -27352,7 +27640,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MIN_I16::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI16 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandI16 src1(gpuDynInst, extData.SRC1);
         VecOperandI16 vdst(gpuDynInst, instData.VDST);
@@ -27376,10 +27663,12 @@ namespace VegaISA
             src1.negModifier();
         }
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::min(src0[lane], src1[lane]);
-            }
+            d[lane] = std::min(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -27421,7 +27710,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_ADD_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -27439,10 +27727,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane];
-            }
+            d[lane] = s0[lane] + s1[lane];
         }
 
         vdst.write();
@@ -27464,7 +27754,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_SUB_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -27482,10 +27771,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] - src1[lane];
-            }
+            d[lane] = s0[lane] - s1[lane];
         }
 
         vdst.write();
@@ -27507,7 +27798,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_SUBREV_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
@@ -27525,10 +27815,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] - src0[lane];
-            }
+            d[lane] = s1[lane] - s0[lane];
         }
 
         vdst.write();
@@ -27570,16 +27862,16 @@ namespace VegaISA
     void
     Inst_VOP3__V_MOV_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, extData.SRC0);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
 
         src.readSrc();
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src[lane];
-            }
+            d[lane] = s[lane];
         }
 
         vdst.write();
@@ -27656,7 +27948,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CVT_F64_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src(gpuDynInst, extData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -27670,10 +27961,11 @@ namespace VegaISA
             src.negModifier();
         }
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
+            d[lane] = (VecElemF64)s[lane];
         }
 
         vdst.write();
@@ -27696,7 +27988,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CVT_F32_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         VecOperandI32 src(gpuDynInst, extData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -27712,10 +28003,11 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
+            d[lane] = (VecElemF32)s[lane];
         }
 
         vdst.write();
@@ -27738,7 +28030,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CVT_F32_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, extData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -27752,10 +28043,11 @@ namespace VegaISA
             src.negModifier();
         }
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
+            d[lane] = (VecElemF32)s[lane];
         }
 
         vdst.write();
@@ -28063,7 +28355,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CVT_F32_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src(gpuDynInst, extData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -28085,10 +28376,11 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF32)src[lane];
-            }
+            d[lane] = (VecElemF32)s[lane];
         }
 
         vdst.write();
@@ -28111,7 +28403,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CVT_F64_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, extData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -28133,10 +28424,11 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
+            d[lane] = (VecElemF64)s[lane];
         }
 
         vdst.write();
@@ -28375,7 +28667,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CVT_F64_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, extData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -28389,10 +28680,11 @@ namespace VegaISA
             src.negModifier();
         }
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (VecElemF64)src[lane];
-            }
+            d[lane] = (VecElemF64)s[lane];
         }
 
         vdst.write();
@@ -28415,7 +28707,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_TRUNC_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src(gpuDynInst, extData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -28429,10 +28720,11 @@ namespace VegaISA
             src.negModifier();
         }
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::trunc(src[lane]);
-            }
+            d[lane] = std::trunc(s[lane]);
         }
 
         vdst.write();
@@ -28456,7 +28748,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CEIL_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src(gpuDynInst, extData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -28470,10 +28761,11 @@ namespace VegaISA
             src.negModifier();
         }
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::ceil(src[lane]);
-            }
+            d[lane] = std::ceil(s[lane]);
         }
 
         vdst.write();
@@ -28537,7 +28829,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_FLOOR_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src(gpuDynInst, extData.SRC0);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
 
@@ -28551,10 +28842,11 @@ namespace VegaISA
             src.negModifier();
         }
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::floor(src[lane]);
-            }
+            d[lane] = std::floor(s[lane]);
         }
 
         vdst.write();
@@ -28618,7 +28910,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_TRUNC_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, extData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -28632,10 +28923,11 @@ namespace VegaISA
             src.negModifier();
         }
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::trunc(src[lane]);
-            }
+            d[lane] = std::trunc(s[lane]);
         }
 
         vdst.write();
@@ -28659,7 +28951,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_CEIL_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, extData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -28673,10 +28964,11 @@ namespace VegaISA
             src.negModifier();
         }
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::ceil(src[lane]);
-            }
+            d[lane] = std::ceil(s[lane]);
         }
 
         vdst.write();
@@ -28740,7 +29032,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_FLOOR_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src(gpuDynInst, extData.SRC0);
         VecOperandF32 vdst(gpuDynInst, instData.VDST);
 
@@ -28754,10 +29045,11 @@ namespace VegaISA
             src.negModifier();
         }
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::floor(src[lane]);
-            }
+            d[lane] = std::floor(s[lane]);
         }
 
         vdst.write();
@@ -29260,7 +29552,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_NOT_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src(gpuDynInst, extData.SRC0);
         VecOperandU32 vdst(gpuDynInst, instData.VDST);
 
@@ -29274,10 +29565,11 @@ namespace VegaISA
             src.negModifier();
         }
 
+        const auto s = src.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = ~src[lane];
-            }
+            d[lane] = ~s[lane];
         }
 
         vdst.write();
@@ -30179,7 +30471,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAD_LEGACY_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandF32 src2(gpuDynInst, extData.SRC2);
@@ -30213,10 +30504,13 @@ namespace VegaISA
             src2.negModifier();
         }
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
+            d[lane] = std::fma(s0[lane], s1[lane], s2[lane]);
         }
 
         vdst.write();
@@ -30240,7 +30534,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAD_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandF32 src2(gpuDynInst, extData.SRC2);
@@ -30274,10 +30567,13 @@ namespace VegaISA
             src2.negModifier();
         }
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
+            d[lane] = std::fma(s0[lane], s1[lane], s2[lane]);
         }
 
         vdst.write();
@@ -30347,7 +30643,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAD_U32_U24::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU32 src2(gpuDynInst, extData.SRC2);
@@ -30367,11 +30662,13 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = bits(src0[lane], 23, 0) * bits(src1[lane], 23, 0)
-                    + src2[lane];
-            }
+            d[lane] = bits(s0[lane], 23, 0) * bits(s1[lane], 23, 0) + s2[lane];
         }
 
         vdst.write();
@@ -30578,7 +30875,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_BFI_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU32 src2(gpuDynInst, extData.SRC2);
@@ -30598,11 +30894,13 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (src0[lane] & src1[lane]) | (~src0[lane]
-                    & src2[lane]);
-            }
+            d[lane] = (s0[lane] & s1[lane]) | (~s0[lane] & s2[lane]);
         }
 
         vdst.write();
@@ -30626,7 +30924,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_FMA_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandF32 src2(gpuDynInst, extData.SRC2);
@@ -30660,10 +30957,13 @@ namespace VegaISA
             src2.negModifier();
         }
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
+            d[lane] = std::fma(s0[lane], s1[lane], s2[lane]);
         }
 
         vdst.write();
@@ -30687,7 +30987,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_FMA_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF64 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandF64 src2(gpuDynInst, extData.SRC2);
@@ -30721,10 +31020,13 @@ namespace VegaISA
             src2.negModifier();
         }
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
+            d[lane] = std::fma(s0[lane], s1[lane], s2[lane]);
         }
 
         vdst.write();
@@ -31211,7 +31513,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MED3_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandF32 src2(gpuDynInst, extData.SRC2);
@@ -31245,10 +31546,13 @@ namespace VegaISA
             src2.negModifier();
         }
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = median(src0[lane], src1[lane], src2[lane]);
-            }
+            d[lane] = median(s0[lane], s1[lane], s2[lane]);
         }
 
         vdst.write();
@@ -31270,7 +31574,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MED3_I32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandI32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandI32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandI32 src2(gpuDynInst, extData.SRC2);
@@ -31290,10 +31593,13 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = median(src0[lane], src1[lane], src2[lane]);
-            }
+            d[lane] = median(s0[lane], s1[lane], s2[lane]);
         }
 
         vdst.write();
@@ -31315,7 +31621,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MED3_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU32 src2(gpuDynInst, extData.SRC2);
@@ -31335,10 +31640,13 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = median(src0[lane], src1[lane], src2[lane]);
-            }
+            d[lane] = median(s0[lane], s1[lane], s2[lane]);
         }
 
         vdst.write();
@@ -31938,7 +32246,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_DIV_FMAS_F32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandF32 src2(gpuDynInst, extData.SRC2);
@@ -31972,10 +32279,13 @@ namespace VegaISA
             src2.negModifier();
         }
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fma(src0[lane], src1[lane], src2[lane]);
-            }
+            d[lane] = std::fma(s0[lane], s1[lane], s2[lane]);
         }
 
         //vdst.write();
@@ -32244,7 +32554,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_XAD_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU32 src2(gpuDynInst, extData.SRC2);
@@ -32264,10 +32573,13 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (src0[lane] ^ src1[lane]) + src2[lane];
-            }
+            d[lane] = (s0[lane] ^ s1[lane]) + s2[lane];
         }
 
         vdst.write();
@@ -32289,7 +32601,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_LSHL_ADD_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU32 src2(gpuDynInst, extData.SRC2);
@@ -32309,11 +32620,13 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (src0[lane] << bits(src1[lane], 4, 0))
-                           + src2[lane];
-            }
+            d[lane] = (s0[lane] << bits(s1[lane], 4, 0)) + s2[lane];
         }
 
         vdst.write();
@@ -32335,7 +32648,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_ADD_LSHL_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU32 src2(gpuDynInst, extData.SRC2);
@@ -32355,11 +32667,13 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] =
-                    (src0[lane] + src1[lane]) << bits(src2[lane], 4, 0);
-            }
+            d[lane] = (s0[lane] + s1[lane]) << bits(s2[lane], 4, 0);
         }
 
         vdst.write();
@@ -32381,7 +32695,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_ADD3_U32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU32 src2(gpuDynInst, extData.SRC2);
@@ -32401,10 +32714,13 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src0[lane] + src1[lane] + src2[lane];
-            }
+            d[lane] = s0[lane] + s1[lane] + s2[lane];
         }
 
         vdst.write();
@@ -32426,7 +32742,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_LSHL_OR_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU32 src2(gpuDynInst, extData.SRC2);
@@ -32446,11 +32761,13 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (src0[lane] << bits(src1[lane], 4, 0))
-                           | src2[lane];
-            }
+            d[lane] = (s0[lane] << bits(s1[lane], 4, 0)) | s2[lane];
         }
 
         vdst.write();
@@ -32473,7 +32790,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_AND_OR_B32::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU32 src1(gpuDynInst, extData.SRC1);
         ConstVecOperandU32 src2(gpuDynInst, extData.SRC2);
@@ -32493,10 +32809,13 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        const auto s2 = src2.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = (src0[lane] & src1[lane]) | src2[lane];
-            }
+            d[lane] = (s0[lane] & s1[lane]) | s2[lane];
         }
 
         vdst.write();
@@ -33151,7 +33470,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MIN_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF64 src1(gpuDynInst, extData.SRC1);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
@@ -33181,10 +33499,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmin(src0[lane], src1[lane]);
-            }
+            d[lane] = std::fmin(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -33207,7 +33527,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_MAX_F64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandF64 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandF64 src1(gpuDynInst, extData.SRC1);
         VecOperandF64 vdst(gpuDynInst, instData.VDST);
@@ -33237,10 +33556,12 @@ namespace VegaISA
         assert(!(instData.ABS & 0x4));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = std::fmax(src0[lane], src1[lane]);
-            }
+            d[lane] = std::fmax(s0[lane], s1[lane]);
         }
 
         vdst.write();
@@ -33731,7 +34052,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_LSHLREV_B64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU64 src1(gpuDynInst, extData.SRC1);
         VecOperandU64 vdst(gpuDynInst, instData.VDST);
@@ -33749,10 +34069,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] << bits(src0[lane], 5, 0);
-            }
+            d[lane] = s1[lane] << bits(s0[lane], 5, 0);
         }
 
         vdst.write();
@@ -33776,7 +34098,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_LSHRREV_B64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandU64 src1(gpuDynInst, extData.SRC1);
         VecOperandU64 vdst(gpuDynInst, instData.VDST);
@@ -33794,10 +34115,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane] = src1[lane] >> bits(src0[lane], 5, 0);
-            }
+            d[lane] = s1[lane] >> bits(s0[lane], 5, 0);
         }
 
         vdst.write();
@@ -33821,7 +34144,6 @@ namespace VegaISA
     void
     Inst_VOP3__V_ASHRREV_I64::execute(GPUDynInstPtr gpuDynInst)
     {
-        Wavefront *wf = gpuDynInst->wavefront();
         ConstVecOperandU32 src0(gpuDynInst, extData.SRC0);
         ConstVecOperandI64 src1(gpuDynInst, extData.SRC1);
         VecOperandU64 vdst(gpuDynInst, instData.VDST);
@@ -33839,11 +34161,12 @@ namespace VegaISA
         assert(!(extData.NEG & 0x2));
         assert(!(extData.NEG & 0x4));
 
+        const auto s0 = src0.lanes();
+        const auto s1 = src1.lanes();
+        auto d = vdst.lanes();
+
         for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-            if (wf->execMask(lane)) {
-                vdst[lane]
-                    = src1[lane] >> bits(src0[lane], 5, 0);
-            }
+            d[lane] = s1[lane] >> bits(s0[lane], 5, 0);
         }
 
         vdst.write();
@@ -33,6 +33,7 @@
 #define __ARCH_VEGA_OPERAND_HH__
 
 #include <array>
+#include <cstring>
 
 #include "arch/amdgpu/vega/gpu_registers.hh"
 #include "arch/generic/vec_reg.hh"
@@ -159,7 +160,12 @@ namespace VegaISA
                 cu->vrf[wf->simdId]->printReg(wf, vgprIdx);
             }
 
-            if (NumDwords == 1) {
+            if (NumDwords == 1 && sizeof(DataType) == sizeof(VecElemU32)) {
+                assert(vrfData[0]);
+                std::memcpy(vecReg.template as<DataType>(),
+                    vrfData[0]->template as<VecElemU32>(),
+                    sizeof(VecElemU32) * NumVecElemPerVecReg);
+            } else if (NumDwords == 1) {
                 assert(vrfData[0]);
                 auto vgpr = vecReg.template as<DataType>();
                 auto reg_file_vgpr = vrfData[0]->template as<VecElemU32>();
@@ -204,6 +210,8 @@ namespace VegaISA
             ComputeUnit *cu = _gpuDynInst->computeUnit();
             VectorMask &exec_mask = _gpuDynInst->isLoad()
                 ? _gpuDynInst->exec_mask : wf->execMask();
+            const bool all_lanes =
+                exec_mask.all() || _gpuDynInst->ignoreExec();
 
             if (NumDwords == 1) {
                 int vgprIdx = cu->registerManager->mapVgpr(wf, _opIdx);
@@ -212,10 +220,15 @@ namespace VegaISA
                 auto reg_file_vgpr = vrfData[0]->template as<VecElemU32>();
                 auto vgpr = vecReg.template as<DataType>();
 
-                for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                    if (exec_mask[lane] || _gpuDynInst->ignoreExec()) {
-                        std::memcpy((void*)&reg_file_vgpr[lane],
-                            (void*)&vgpr[lane], sizeof(DataType));
+                if (all_lanes && sizeof(DataType) == sizeof(VecElemU32)) {
+                    std::memcpy(reg_file_vgpr, vgpr,
+                        sizeof(VecElemU32) * NumVecElemPerVecReg);
+                } else {
+                    for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
+                        if (all_lanes || exec_mask[lane]) {
+                            std::memcpy((void*)&reg_file_vgpr[lane],
+                                (void*)&vgpr[lane], sizeof(DataType));
+                        }
                     }
                 }
 
@@ -233,7 +246,7 @@ namespace VegaISA
                 auto vgpr = vecReg.template as<VecElemU64>();
 
                 for (int lane = 0; lane < NumVecElemPerVecReg; ++lane) {
-                    if (exec_mask[lane] || _gpuDynInst->ignoreExec()) {
+                    if (all_lanes || exec_mask[lane]) {
                         reg_file_vgpr0[lane] = ((VecElemU32*)&vgpr[lane])[0];
                         reg_file_vgpr1[lane] = ((VecElemU32*)&vgpr[lane])[1];
                     }
@@ -315,6 +328,59 @@ namespace VegaISA
             return vecReg.template as<DataType>()[idx];
         }
 
+        /**
+         * the values of all the lanes of a source operand, with scalars
+         * broadcast and the modifiers applied. this lets instructions
+         * compute every lane in a single loop the compiler can vectorize,
+         * instead of checking the exec mask lane by lane: inactive lanes
+         * are discarded when the destination is written, so computing
+         * them must only be free of side effects.
+         */
+        template<bool Condition = (NumDwords == 1 || NumDwords == 2) && Const>
+        typename std::enable_if<Condition,
+            std::array<DataType, NumVecElemPerVecReg>>::type
+        lanes() const
+        {
+            std::array<DataType, NumVecElemPerVecReg> vals;
+
+            if (scalar) {
+                vals.fill(scRegData.rawData());
+            } else {
+                std::memcpy(vals.data(), vecReg.template as<DataType>(),
+                    sizeof(vals));
+            }
+
+            if (absMod) {
+                assert(std::is_floating_point_v<DataType>);
+                for (auto &val : vals) {
+                    val = std::fabs(val);
+                }
+            }
+
+            if (negMod) {
+                assert(std::is_floating_point_v<DataType>);
+                for (auto &val : vals) {
+                    val = -val;
+                }
+            }
+
+            return vals;
+        }
+
+        /**
+         * the lanes of a destination operand (or of a source operand
+         * read as a non-constant one), which are written to the register
+         * file for the active lanes only.
+         */
+        template<bool Condition = (NumDwords == 1 || NumDwords == 2) && !Const>
+        typename std::enable_if<Condition, DataType*>::type
+        lanes()
+        {
+            assert(!scalar);
+
+            return vecReg.template as<DataType>();
+        }
+
         private:
           /**
            * if we determine that this operand is a scalar (reg or constant)
@@ -55,6 +55,20 @@ class ArmTableWalker(ClockedObject):
     num_squash_per_cycle = Param.Unsigned(
         2, "Number of outstanding walks that can be squashed per cycle"
     )
+    max_outstanding_walks = Param.Unsigned(
+        1, "Number of timing walks which can be in progress at once"
+    )
+    coalesce_walks = Param.Bool(
+        True,
+        "Hold back pending walks to a page which is already being walked "
+        "until that walk completes (only relevant with more than one "
+        "outstanding walk)",
+    )
+    walk_caches = VectorParam.ArmTLB(
+        [],
+        "Dedicated page walk caches, holding the partial translations "
+        "of the lookup levels listed in their partial_levels",
+    )
 
     port = RequestPort("Table Walker port")
 
@@ -97,6 +111,13 @@ class ArmMMU(BaseMMU):
 
     sys = Param.System(Parent.any, "system object parameter")
 
+    translation_cache_size = Param.Unsigned(
+        0,
+        "Number of entries of the cache of complete translation results "
+        "used by atomic accesses in full system mode (0 to disable it). "
+        "Hits bypass the TLBs, so their statistics are not updated",
+    )
+
     release_se = Param.ArmRelease(
         Parent.isa[0].release_se,
         "Set of features/extensions to use in SE mode",
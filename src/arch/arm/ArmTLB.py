@@ -36,6 +36,7 @@
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 from m5.objects.BaseTLB import BaseTLB
+from m5.objects.ReplacementPolicies import *
 from m5.params import *
 from m5.proxy import *
 from m5.SimObject import SimObject
@@ -51,6 +52,17 @@ class ArmTLB(BaseTLB):
     cxx_header = "arch/arm/tlb.hh"
     sys = Param.System(Parent.any, "system object parameter")
     size = Param.Int(64, "TLB size")
+    assoc = Param.Int(
+        Self.size,
+        "TLB associativity; entries are indexed by virtual page number "
+        "(one set per page size), and a value equal to size makes the "
+        "TLB fully associative",
+    )
+    # Hits on the two most recently used entries don't update the
+    # replacement order, as when the TLB kept its entries in MRU order
+    replacement_policy = Param.BaseReplacementPolicy(
+        ListLRURP(mru_range=1), "Replacement policy"
+    )
     is_stage2 = Param.Bool(False, "Is this a stage 2 TLB?")
 
     partial_levels = VectorParam.ArmLookupLevel(
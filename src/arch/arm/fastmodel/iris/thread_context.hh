@@ -229,6 +229,13 @@ class ThreadContext : public gem5::ThreadContext
 
     void sendFunctional(PacketPtr pkt) override;
 
+    void
+    sendMemBackdoorReq(const MemBackdoorReq &req,
+                       MemBackdoorPtr &backdoor) override
+    {
+        // The memory of fast models is only reachable through Iris.
+    }
+
     Process *
     getProcessPtr() override
     {
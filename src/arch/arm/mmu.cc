@@ -45,6 +45,7 @@
 #include "arch/arm/stage2_lookup.hh"
 #include "arch/arm/table_walker.hh"
 #include "arch/arm/tlbi_op.hh"
+#include "base/intmath.hh"
 #include "debug/TLB.hh"
 #include "debug/TLBVerbose.hh"
 #include "mem/packet_access.hh"
@@ -68,6 +69,7 @@ MMU::MMU(const ArmMMUParams &p)
     _attr(0),
     _release(nullptr),
     _hasWalkCache(false),
+    translationCache(p.translation_cache_size),
     stats(this)
 {
     // Cache system-level properties
@@ -129,10 +131,37 @@ MMU::checkWalkCache() const
 void
 MMU::drainResume()
 {
+    translationCache.flush();
     s1State.miscRegValid = false;
     s2State.miscRegValid = false;
 }
 
+void
+MMU::flushWalkCaches(const TLBIOp &tlbi_op, bool stage2)
+{
+    if (stage2) {
+        itbStage2Walker->flushWalkCaches(tlbi_op);
+        dtbStage2Walker->flushWalkCaches(tlbi_op);
+    } else {
+        itbWalker->flushWalkCaches(tlbi_op);
+        dtbWalker->flushWalkCaches(tlbi_op);
+    }
+}
+
+void
+MMU::flushAll()
+{
+    BaseMMU::flushAll();
+    translationCache.flush();
+    itbStage2->flushAll();
+    dtbStage2->flushAll();
+
+    itbWalker->flushWalkCaches();
+    dtbWalker->flushWalkCaches();
+    itbStage2Walker->flushWalkCaches();
+    dtbStage2Walker->flushWalkCaches();
+}
+
 TLB *
 MMU::getTlb(BaseMMU::Mode mode, bool stage2) const
 {
@@ -196,6 +225,7 @@ MMU::translateFunctional(ThreadContext *tc, Addr va, Addr &pa)
 void
 MMU::invalidateMiscReg()
 {
+    translationCache.flush();
     s1State.miscRegValid = false;
     s1State.computeAddrTop.flush();
     s2State.computeAddrTop.flush();
@@ -1036,6 +1066,28 @@ MMU::translateAtomic(const RequestPtr &req, ThreadContext *tc, Mode mode,
 {
     auto& state = updateMiscReg(tc, tran_type, stage2);
 
+    // Only plain full system translations are cached: address
+    // translation instructions need to go through the whole process
+    // in order to report their attributes, while the test interface
+    // and the debug architecture need to observe every access.
+    const bool use_cache = FullSystem && translationCache.enabled() &&
+        !stage2 && tran_type == NormalTran && !test &&
+        !ArmISA::ISA::getSelfDebug(tc)->enabled();
+    const Request::FlagsType req_flags = req->getFlags();
+
+    if (use_cache) {
+        if (auto *entry = translationCache.lookup(req, mode, req_flags,
+                                                  state)) {
+            stats.translationCacheHits++;
+            req->setFlags(entry->setFlags);
+            req->setPaddr((entry->ppn << PageShift) |
+                          (req->getVaddr() & mask(PageShift)));
+            setAttr(entry->attr);
+            return NoFault;
+        }
+        stats.translationCacheMisses++;
+    }
+
     bool delay = false;
     Fault fault;
     if (FullSystem)
@@ -1044,6 +1096,14 @@ MMU::translateAtomic(const RequestPtr &req, ThreadContext *tc, Mode mode,
     else
         fault = translateSe(req, tc, mode, NULL, delay, false, state);
     assert(!delay);
+
+    // Pseudo instructions are implemented through a local accessor
+    // set up by finalizePhysical, don't bypass it
+    if (use_cache && fault == NoFault &&
+        !m5opRange.contains(req->getPaddr())) {
+        translationCache.insert(req, mode, req_flags, state, _attr);
+    }
+
     return fault;
 }
 
@@ -1188,6 +1248,10 @@ MMU::updateMiscReg(ThreadContext *tc,
         for (auto tlb : unified) {
             static_cast<TLB*>(tlb)->setVMID(state.vmid);
         }
+        for (auto walker : {itbWalker, dtbWalker,
+                             itbStage2Walker, dtbStage2Walker}) {
+            walker->setWalkCachesVMID(state.vmid);
+        }
 
         miscRegContext = tc->contextId();
     }
@@ -1564,6 +1628,65 @@ MMU::getResultTe(TlbEntry **te, const RequestPtr &req,
     return fault;
 }
 
+MMU::TranslationCache::TranslationCache(unsigned entries)
+  : table(entries)
+{
+    fatal_if(entries && !isPowerOf2(entries),
+             "The number of translation cache entries (%d) must be a "
+             "power of 2\n", entries);
+}
+
+const MMU::TranslationCache::Entry *
+MMU::TranslationCache::lookup(const RequestPtr &req, Mode mode,
+                              Request::FlagsType req_flags,
+                              const CachedState &state) const
+{
+    const Addr vaddr = req->getVaddr();
+
+    // Misaligned accesses might fault regardless of the translation
+    if (mode != Execute && (vaddr & mask(req_flags & AlignmentMask)))
+        return nullptr;
+
+    const Addr vpn = vaddr >> PageShift;
+    const Entry &entry = slot(vpn, mode);
+    if (entry.epoch == epoch && entry.vpn == vpn && entry.mode == mode &&
+        entry.reqFlags == req_flags && entry.asid == state.asid &&
+        entry.vmid == state.vmid && entry.el == state.aarch64EL &&
+        entry.isPriv == state.isPriv && entry.isSecure == state.isSecure &&
+        entry.isHyp == state.isHyp) {
+        return &entry;
+    } else {
+        return nullptr;
+    }
+}
+
+void
+MMU::TranslationCache::insert(const RequestPtr &req, Mode mode,
+                              Request::FlagsType req_flags,
+                              const CachedState &state, uint64_t attr)
+{
+    const Addr vaddr = req->getVaddr();
+    if (mode != Execute && (vaddr & mask(req_flags & AlignmentMask)))
+        return;
+
+    const Addr vpn = vaddr >> PageShift;
+    Entry &entry = slot(vpn, mode);
+    entry.epoch = epoch;
+    entry.vpn = vpn;
+    entry.mode = mode;
+    entry.reqFlags = req_flags;
+    entry.asid = state.asid;
+    entry.vmid = state.vmid;
+    entry.el = state.aarch64EL;
+    entry.isPriv = state.isPriv;
+    entry.isSecure = state.isSecure;
+    entry.isHyp = state.isHyp;
+    entry.ppn = req->getPaddr() >> PageShift;
+    entry.setFlags =
+        static_cast<Request::FlagsType>(req->getFlags()) & ~req_flags;
+    entry.attr = attr;
+}
+
 bool
 MMU::isCompleteTranslation(TlbEntry *entry) const
 {
@@ -1639,8 +1762,16 @@ MMU::Stats::Stats(statistics::Group *parent)
     ADD_STAT(domainFaults, statistics::units::Count::get(),
              "Number of MMU faults due to domain restrictions"),
     ADD_STAT(permsFaults, statistics::units::Count::get(),
-             "Number of MMU faults due to permissions restrictions")
+             "Number of MMU faults due to permissions restrictions"),
+    ADD_STAT(translationCacheHits, statistics::units::Count::get(),
+             "Number of atomic translations served by the translation "
+             "cache"),
+    ADD_STAT(translationCacheMisses, statistics::units::Count::get(),
+             "Number of atomic translations missing in the translation "
+             "cache")
 {
+    translationCacheHits.flags(statistics::nozero);
+    translationCacheMisses.flags(statistics::nozero);
 }
 
 } // namespace gem5
@@ -41,6 +41,8 @@
 #ifndef __ARCH_ARM_MMU_HH__
 #define __ARCH_ARM_MMU_HH__
 
+#include <vector>
+
 #include "arch/arm/page_size.hh"
 #include "arch/arm/tlb.hh"
 #include "arch/arm/utility.hh"
@@ -212,6 +214,74 @@ class MMU : public BaseMMU
                  bool, TCR, ExceptionLevel> computeAddrTop;
     };
 
+    /**
+     * Direct mapped cache of complete (stage 1 + stage 2) atomic
+     * translation results. A hit skips the TLB lookup, the permission
+     * checks and the attribute decoding. Entries are keyed on the
+     * virtual page and on the translation context, and they are
+     * dropped on any TLB maintenance operation and whenever the cached
+     * system registers are invalidated.
+     */
+    class TranslationCache
+    {
+      public:
+        struct Entry
+        {
+            // The entry is valid if it was filled in the current epoch
+            uint64_t epoch = 0;
+
+            // Lookup key
+            Addr vpn = 0;
+            Mode mode = Read;
+            Request::FlagsType reqFlags = 0;
+            uint16_t asid = 0;
+            vmid_t vmid = 0;
+            ExceptionLevel el = EL0;
+            bool isPriv = false;
+            bool isSecure = false;
+            bool isHyp = false;
+
+            // Translation result
+            Addr ppn = 0;
+            Request::FlagsType setFlags = 0;
+            uint64_t attr = 0;
+        };
+
+        TranslationCache(unsigned entries);
+
+        bool enabled() const { return !table.empty(); }
+
+        /** Return the entry matching the request, if any */
+        const Entry *lookup(const RequestPtr &req, Mode mode,
+                            Request::FlagsType req_flags,
+                            const CachedState &state) const;
+
+        /** Record the outcome of a successful translation */
+        void insert(const RequestPtr &req, Mode mode,
+                    Request::FlagsType req_flags, const CachedState &state,
+                    uint64_t attr);
+
+        /** Invalidate all the entries */
+        void flush() { epoch++; }
+
+      protected:
+        Entry &
+        slot(Addr vpn, Mode mode)
+        {
+            return table[((vpn << 2) | mode) & (table.size() - 1)];
+        }
+
+        const Entry &
+        slot(Addr vpn, Mode mode) const
+        {
+            return table[((vpn << 2) | mode) & (table.size() - 1)];
+        }
+
+        std::vector<Entry> table;
+
+        uint64_t epoch = 1;
+    };
+
     MMU(const ArmMMUParams &p);
 
     void init() override;
@@ -314,6 +384,7 @@ class MMU : public BaseMMU
     void
     flushStage1(const OP &tlbi_op)
     {
+        translationCache.flush();
         for (auto tlb : instruction) {
             static_cast<TLB*>(tlb)->flush(tlbi_op);
         }
@@ -323,47 +394,54 @@ class MMU : public BaseMMU
         for (auto tlb : unified) {
             static_cast<TLB*>(tlb)->flush(tlbi_op);
         }
+        flushWalkCaches(tlbi_op, false);
     }
 
     template <typename OP>
     void
     flushStage2(const OP &tlbi_op)
     {
+        translationCache.flush();
         itbStage2->flush(tlbi_op);
         dtbStage2->flush(tlbi_op);
+        flushWalkCaches(tlbi_op, true);
     }
 
     template <typename OP>
     void
     iflush(const OP &tlbi_op)
     {
+        translationCache.flush();
         for (auto tlb : instruction) {
             static_cast<TLB*>(tlb)->flush(tlbi_op);
         }
         for (auto tlb : unified) {
             static_cast<TLB*>(tlb)->flush(tlbi_op);
         }
+        flushWalkCaches(tlbi_op, false);
     }
 
     template <typename OP>
     void
     dflush(const OP &tlbi_op)
     {
+        translationCache.flush();
         for (auto tlb : data) {
             static_cast<TLB*>(tlb)->flush(tlbi_op);
         }
         for (auto tlb : unified) {
             static_cast<TLB*>(tlb)->flush(tlbi_op);
         }
+        flushWalkCaches(tlbi_op, false);
     }
 
-    void
-    flushAll() override
-    {
-        BaseMMU::flushAll();
-        itbStage2->flushAll();
-        dtbStage2->flushAll();
-    }
+    /**
+     * Invalidate the entries matching a TLBI op in the page walk caches
+     * of the stage 1 or stage 2 table walkers
+     */
+    void flushWalkCaches(const TLBIOp &tlbi_op, bool stage2);
+
+    void flushAll() override;
 
     uint64_t
     getAttr() const
@@ -499,6 +577,8 @@ class MMU : public BaseMMU
 
     bool _hasWalkCache;
 
+    TranslationCache translationCache;
+
     struct Stats : public statistics::Group
     {
         Stats(statistics::Group *parent);
@@ -507,6 +587,8 @@ class MMU : public BaseMMU
         mutable statistics::Scalar prefetchFaults;
         mutable statistics::Scalar domainFaults;
         mutable statistics::Scalar permsFaults;
+        mutable statistics::Scalar translationCacheHits;
+        mutable statistics::Scalar translationCacheMisses;
     } stats;
 
 };
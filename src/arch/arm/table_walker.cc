@@ -36,6 +36,7 @@
  */
 #include "arch/arm/table_walker.hh"
 
+#include <algorithm>
 #include <cassert>
 #include <memory>
 
@@ -64,7 +65,10 @@ TableWalker::TableWalker(const Params &p)
       requestorId(p.sys->getRequestorId(this)),
       port(new Port(*this, requestorId)),
       isStage2(p.is_stage2), tlb(NULL),
-      currState(NULL), pending(false),
+      currState(NULL), activeWalks(0),
+      maxActiveWalks(p.max_outstanding_walks),
+      coalesceWalks(p.coalesce_walks),
+      walkCaches(p.walk_caches.begin(), p.walk_caches.end()),
       numSquashable(p.num_squash_per_cycle),
       release(nullptr),
       stats(this),
@@ -82,6 +86,9 @@ TableWalker::TableWalker(const Params &p)
 {
     sctlr = 0;
 
+    fatal_if(maxActiveWalks == 0,
+             "%s: max_outstanding_walks must be at least 1\n", name());
+
     // Cache system-level properties
     if (FullSystem) {
         ArmSystem *arm_sys = dynamic_cast<ArmSystem *>(p.sys);
@@ -134,7 +141,8 @@ TableWalker::WalkerState::WalkerState() :
     pxnTable(false), hpd(false), stage2Req(false),
     stage2Tran(nullptr), timing(false), functional(false),
     mode(BaseMMU::Read), tranType(MMU::NormalTran), l2Desc(l1Desc),
-    delayed(false), tableWalker(nullptr)
+    delayed(false), tableWalker(nullptr), descReady(false),
+    coalesced(false)
 {
 }
 
@@ -151,7 +159,7 @@ PacketPtr
 TableWalker::Port::createPacket(
     Addr desc_addr, int size,
     uint8_t *data, Request::Flags flags, Tick delay,
-    Event *event)
+    Event *event, WalkerState *walk)
 {
     RequestPtr req = std::make_shared<Request>(
         desc_addr, size, flags, requestorId);
@@ -163,6 +171,7 @@ TableWalker::Port::createPacket(
     auto state = new TableWalkerState;
     state->event = event;
     state->delay = delay;
+    state->walk = walk;
 
     pkt->senderState = state;
     return pkt;
@@ -196,9 +205,9 @@ void
 TableWalker::Port::sendTimingReq(
     Addr desc_addr, int size,
     uint8_t *data, Request::Flags flags, Tick delay,
-    Event *event)
+    Event *event, WalkerState *walk)
 {
-    auto pkt = createPacket(desc_addr, size, data, flags, delay, event);
+    auto pkt = createPacket(desc_addr, size, data, flags, delay, event, walk);
 
     schedTimingReq(pkt, curTick());
 }
@@ -234,7 +243,13 @@ void
 TableWalker::Port::handleResp(TableWalkerState *state, Addr addr,
                               Addr size, Tick delay)
 {
-    if (state->event) {
+    if (state->walk) {
+        state->walk->descReady = true;
+    }
+    // The descriptor event of a lookup level is shared by all the
+    // walks waiting at that level: it might already be scheduled to
+    // process a descriptor received by another walk
+    if (state->event && !state->event->scheduled()) {
         owner.schedule(state->event, curTick() + delay);
     }
     delete state;
@@ -463,12 +478,18 @@ TableWalker::walk(const RequestPtr &_req, ThreadContext *_tc, uint16_t _asid,
         return fault;
     }
 
-    if (pending || pendingQueue.size()) {
+    if (activeWalks >= maxActiveWalks || pendingQueue.size()) {
         pendingQueue.push_back(currState);
         currState = NULL;
         pendingChange();
+        if (activeWalks < maxActiveWalks) {
+            // Some older walks are held back by an in progress walk of
+            // the same page, try starting this one
+            nextWalk(_tc);
+        }
     } else {
-        pending = true;
+        activeWalks++;
+        stats.activeWalks.sample(activeWalks);
         pendingChange();
         if (currState->aarch64)
             return processWalkAArch64();
@@ -487,7 +508,18 @@ TableWalker::processWalkWrapper()
     assert(!currState);
     assert(pendingQueue.size());
     pendingChange();
-    currState = pendingQueue.front();
+
+    // The walk will be started once an in progress walk completes
+    if (activeWalks >= maxActiveWalks)
+        return;
+
+    auto walk_it = nextPendingWalk(pendingQueue.begin());
+    if (walk_it == pendingQueue.end()) {
+        // Every pending walk targets a page which is being walked,
+        // they will be reconsidered once those walks complete
+        return;
+    }
+    currState = *walk_it;
 
     // Check if a previous walk filled this request already
     // @TODO Should this always be the TLB or should we look in the stage2 TLB?
@@ -502,14 +534,16 @@ TableWalker::processWalkWrapper()
     // previous request has been successfully translated.
     if (!currState->transState->squashed() && (!te || te->partial)) {
         // We've got a valid request, lets process it
-        pending = true;
-        pendingQueue.pop_front();
+        activeWalks++;
+        stats.activeWalks.sample(activeWalks);
+        pendingQueue.erase(walk_it);
         // Keep currState in case one of the processWalk... calls NULLs it
 
         if (te && te->partial) {
             currState->walkEntry = *te;
         }
         WalkerState *curr_state_copy = currState;
+        ThreadContext *tc = currState->tc;
         Fault f;
         if (currState->aarch64)
             f = processWalkAArch64();
@@ -525,6 +559,10 @@ TableWalker::processWalkWrapper()
 
             delete curr_state_copy;
         }
+
+        // Start the next pending walk (if any) next cycle
+        if (activeWalks < maxActiveWalks && pendingQueue.size())
+            nextWalk(tc);
         return;
     }
 
@@ -536,7 +574,7 @@ TableWalker::processWalkWrapper()
     while ((num_squashed < numSquashable) && currState &&
            (currState->transState->squashed() ||
             (te && !te->partial))) {
-        pendingQueue.pop_front();
+        walk_it = pendingQueue.erase(walk_it);
         num_squashed++;
         stats.squashedBefore++;
 
@@ -560,8 +598,9 @@ TableWalker::processWalkWrapper()
         delete currState;
 
         // peak at the next one
-        if (pendingQueue.size()) {
-            currState = pendingQueue.front();
+        walk_it = nextPendingWalk(walk_it);
+        if (walk_it != pendingQueue.end()) {
+            currState = *walk_it;
             te = mmu->lookup(currState->vaddr, currState->asid,
                 currState->vmid, currState->isHyp, currState->isSecure, true,
                 false, currState->el, false, isStage2, currState->mode);
@@ -577,6 +616,43 @@ TableWalker::processWalkWrapper()
     currState = NULL;
 }
 
+bool
+TableWalker::walkInProgress(const WalkerState *walk) const
+{
+    for (const auto &queue : stateQueues) {
+        for (const auto *state : queue) {
+            if (state->vaddr >> PageShift == walk->vaddr >> PageShift &&
+                state->asid == walk->asid && state->vmid == walk->vmid &&
+                state->isHyp == walk->isHyp &&
+                state->isSecure == walk->isSecure &&
+                state->el == walk->el) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+std::list<TableWalker::WalkerState *>::iterator
+TableWalker::nextPendingWalk(std::list<WalkerState *>::iterator it)
+{
+    if (!coalesceWalks || !activeWalks)
+        return it;
+
+    // Squashed walks are never held back so that they can be
+    // cleaned up
+    for (; it != pendingQueue.end(); ++it) {
+        if ((*it)->transState->squashed() || !walkInProgress(*it))
+            break;
+
+        if (!(*it)->coalesced) {
+            (*it)->coalesced = true;
+            stats.coalescedWalks++;
+        }
+    }
+    return it;
+}
+
 Fault
 TableWalker::processWalk()
 {
@@ -657,7 +733,7 @@ TableWalker::processWalk()
     if (f) {
         DPRINTF(TLB, "Trickbox check caused fault on %#x\n", currState->vaddr_tainted);
         if (currState->timing) {
-            pending = false;
+            activeWalks--;
             nextWalk(currState->tc);
             currState = NULL;
         } else {
@@ -833,7 +909,7 @@ TableWalker::processWalkLPAE()
     if (f) {
         DPRINTF(TLB, "Trickbox check caused fault on %#x\n", currState->vaddr_tainted);
         if (currState->timing) {
-            pending = false;
+            activeWalks--;
             nextWalk(currState->tc);
             currState = NULL;
         } else {
@@ -1085,7 +1161,7 @@ TableWalker::processWalkAArch64()
                 isStage2, ArmFault::LpaeTran);
 
         if (currState->timing) {
-            pending = false;
+            activeWalks--;
             nextWalk(currState->tc);
             currState = NULL;
         } else {
@@ -1135,7 +1211,7 @@ TableWalker::processWalkAArch64()
 
 
         if (currState->timing) {
-            pending = false;
+            activeWalks--;
             nextWalk(currState->tc);
             currState = NULL;
         } else {
@@ -1152,7 +1228,7 @@ TableWalker::processWalkAArch64()
     if (f) {
         DPRINTF(TLB, "Trickbox check caused fault on %#x\n", currState->vaddr_tainted);
         if (currState->timing) {
-            pending = false;
+            activeWalks--;
             nextWalk(currState->tc);
             currState = NULL;
         } else {
@@ -1190,6 +1266,26 @@ TableWalker::processWalkAArch64()
     return f;
 }
 
+void
+TableWalker::lookupWalkCaches()
+{
+    TlbEntry::Lookup lookup_data;
+
+    lookup_data.va = currState->vaddr;
+    lookup_data.asn = currState->asid;
+    lookup_data.ignoreAsn = false;
+    lookup_data.vmid = currState->vmid;
+    lookup_data.hyp = currState->isHyp;
+    lookup_data.secure = currState->isSecure;
+    lookup_data.functional = currState->functional;
+    lookup_data.targetEL = currState->el;
+    lookup_data.inHost = false;
+    lookup_data.mode = currState->mode;
+
+    // Keep the hit skipping the most lookup levels
+    walkCaches.lookup(lookup_data, currState->walkEntry);
+}
+
 std::tuple<Addr, Addr, TableWalker::LookupLevel>
 TableWalker::walkAddresses(Addr ttbr, GrainSize tg, int tsz, int pa_range)
 {
@@ -1199,6 +1295,8 @@ TableWalker::walkAddresses(Addr ttbr, GrainSize tg, int tsz, int pa_range)
     Addr table_addr = 0;
     Addr desc_addr = 0;
 
+    lookupWalkCaches();
+
     if (currState->walkEntry.valid) {
         // WalkCache hit
         TlbEntry* entry = &currState->walkEntry;
@@ -1920,7 +2018,7 @@ TableWalker::doLongDescriptor()
                 return;
             }
 
-            if (mmu->hasWalkCache()) {
+            if (mmu->hasWalkCache() || !walkCaches.empty()) {
                 insertPartialTableEntry(currState->longDesc);
             }
 
@@ -2021,7 +2119,7 @@ TableWalker::doL2Descriptor()
 void
 TableWalker::doL1DescriptorWrapper()
 {
-    currState = stateQueues[LookupLevel::L1].front();
+    currState = readyWalk(LookupLevel::L1);
     currState->delayed = false;
     // if there's a stage2 translation object we don't need it any more
     if (currState->stage2Tran) {
@@ -2039,14 +2137,14 @@ TableWalker::doL1DescriptorWrapper()
             currState->vaddr_tainted);
     doL1Descriptor();
 
-    stateQueues[LookupLevel::L1].pop_front();
+    stateQueues[LookupLevel::L1].remove(currState);
     // Check if fault was generated
     if (currState->fault != NoFault) {
         currState->transState->finish(currState->fault, currState->req,
                                       currState->tc, currState->mode);
         stats.walksShortTerminatedAtLevel[0]++;
 
-        pending = false;
+        activeWalks--;
         nextWalk(currState->tc);
 
         currState->req = NULL;
@@ -2066,7 +2164,7 @@ TableWalker::doL1DescriptorWrapper()
 
         stats.walksShortTerminatedAtLevel[0]++;
 
-        pending = false;
+        activeWalks--;
         nextWalk(currState->tc);
 
         currState->req = NULL;
@@ -2078,12 +2176,14 @@ TableWalker::doL1DescriptorWrapper()
         stateQueues[LookupLevel::L2].push_back(currState);
     }
     currState = NULL;
+
+    scheduleReadyWalks(LookupLevel::L1, &doL1DescEvent);
 }
 
 void
 TableWalker::doL2DescriptorWrapper()
 {
-    currState = stateQueues[LookupLevel::L2].front();
+    currState = readyWalk(LookupLevel::L2);
     assert(currState->delayed);
     // if there's a stage2 translation object we don't need it any more
     if (currState->stage2Tran) {
@@ -2112,8 +2212,8 @@ TableWalker::doL2DescriptorWrapper()
     }
 
 
-    stateQueues[LookupLevel::L2].pop_front();
-    pending = false;
+    stateQueues[LookupLevel::L2].remove(currState);
+    activeWalks--;
     nextWalk(currState->tc);
 
     currState->req = NULL;
@@ -2122,6 +2222,8 @@ TableWalker::doL2DescriptorWrapper()
 
     delete currState;
     currState = NULL;
+
+    scheduleReadyWalks(LookupLevel::L2, &doL2DescEvent);
 }
 
 void
@@ -2151,7 +2253,7 @@ TableWalker::doL3LongDescriptorWrapper()
 void
 TableWalker::doLongDescriptorWrapper(LookupLevel curr_lookup_level)
 {
-    currState = stateQueues[curr_lookup_level].front();
+    currState = readyWalk(curr_lookup_level);
     assert(curr_lookup_level == currState->longDesc.lookupLevel);
     currState->delayed = false;
 
@@ -2165,14 +2267,14 @@ TableWalker::doLongDescriptorWrapper(LookupLevel curr_lookup_level)
             currState->vaddr_tainted);
     doLongDescriptor();
 
-    stateQueues[curr_lookup_level].pop_front();
+    stateQueues[curr_lookup_level].remove(currState);
 
     if (currState->fault != NoFault) {
         // A fault was generated
         currState->transState->finish(currState->fault, currState->req,
                                       currState->tc, currState->mode);
 
-        pending = false;
+        activeWalks--;
         nextWalk(currState->tc);
 
         currState->req = NULL;
@@ -2190,7 +2292,7 @@ TableWalker::doLongDescriptorWrapper(LookupLevel curr_lookup_level)
 
         stats.walksLongTerminatedAtLevel[(unsigned) curr_lookup_level]++;
 
-        pending = false;
+        activeWalks--;
         nextWalk(currState->tc);
 
         currState->req = NULL;
@@ -2204,14 +2306,45 @@ TableWalker::doLongDescriptorWrapper(LookupLevel curr_lookup_level)
         stateQueues[currState->longDesc.lookupLevel].push_back(currState);
     }
     currState = NULL;
+
+    scheduleReadyWalks(curr_lookup_level,
+                       LongDescEventByLevel[curr_lookup_level]);
+}
+
+TableWalker::WalkerState *
+TableWalker::readyWalk(LookupLevel lookup_level)
+{
+    auto &queue = stateQueues[lookup_level];
+    assert(!queue.empty());
+
+    // Descriptors of concurrent walks can be received out of order
+    auto it = std::find_if(queue.begin(), queue.end(),
+        [](const WalkerState *walk) { return walk->descReady; });
+    WalkerState *walk = it != queue.end() ? *it : queue.front();
+
+    walk->descReady = false;
+    return walk;
+}
+
+void
+TableWalker::scheduleReadyWalks(LookupLevel lookup_level, Event *event)
+{
+    const auto &queue = stateQueues[lookup_level];
+    const bool ready = std::any_of(queue.begin(), queue.end(),
+        [](const WalkerState *walk) { return walk->descReady; });
+
+    if (ready && !event->scheduled())
+        schedule(event, curTick());
 }
 
 
 void
 TableWalker::nextWalk(ThreadContext *tc)
 {
-    if (pendingQueue.size())
-        schedule(doProcessEvent, clockEdge(Cycles(1)));
+    if (pendingQueue.size()) {
+        if (!doProcessEvent.scheduled())
+            schedule(doProcessEvent, clockEdge(Cycles(1)));
+    }
     else
         completeDrain();
 }
@@ -2235,7 +2368,7 @@ TableWalker::fetchDescriptor(Addr descAddr, uint8_t *data, int numBytes,
 
         if (isTiming) {
             auto *tran = new
-                Stage2Walk(*this, data, event, currState->vaddr,
+                Stage2Walk(*this, data, event, currState, currState->vaddr,
                     currState->mode, currState->tranType);
             currState->stage2Tran = tran;
             readDataTimed(currState->tc, descAddr, tran, numBytes, flags);
@@ -2265,7 +2398,7 @@ TableWalker::fetchDescriptor(Addr descAddr, uint8_t *data, int numBytes,
     } else {
         if (isTiming) {
             port->sendTimingReq(descAddr, numBytes, data, flags,
-                currState->tc->getCpuPtr()->clockPeriod(), event);
+                currState->tc->getCpuPtr()->clockPeriod(), event, currState);
 
             if (queueIndex >= 0) {
                 DPRINTF(PageTableWalker, "Adding to walker fifo: "
@@ -2337,7 +2470,23 @@ TableWalker::insertPartialTableEntry(LongDescriptor &descriptor)
             descriptor.getRawData());
 
     // Insert the entry into the TLBs
-    tlb->multiInsert(te);
+    if (mmu->hasWalkCache())
+        tlb->multiInsert(te);
+
+    // and into the page walk caches configured for its lookup level
+    walkCaches.insert(te);
+}
+
+void
+TableWalker::flushWalkCaches(const TLBIOp &tlbi_op)
+{
+    walkCaches.flush(tlbi_op);
+}
+
+void
+TableWalker::flushWalkCaches()
+{
+    walkCaches.flushAll();
 }
 
 void
@@ -2537,9 +2686,9 @@ TableWalker::readDataTimed(ThreadContext *tc, Addr desc_addr,
 }
 
 TableWalker::Stage2Walk::Stage2Walk(TableWalker &_parent,
-        uint8_t *_data, Event *_event, Addr vaddr, BaseMMU::Mode _mode,
-        MMU::ArmTranslationType tran_type)
-    : data(_data), numBytes(0), event(_event), parent(_parent),
+        uint8_t *_data, Event *_event, WalkerState *_walk, Addr vaddr,
+        BaseMMU::Mode _mode, MMU::ArmTranslationType tran_type)
+    : data(_data), numBytes(0), event(_event), walk(_walk), parent(_parent),
       oVAddr(vaddr), mode(_mode), tranType(tran_type), fault(NoFault)
 {
     req = std::make_shared<Request>();
@@ -2563,10 +2712,11 @@ TableWalker::Stage2Walk::finish(const Fault &_fault,
     if (_fault == NoFault && !req->getFlags().isSet(Request::NO_ACCESS)) {
         parent.getTableWalkerPort().sendTimingReq(
             req->getPaddr(), numBytes, data, req->getFlags(),
-            tc->getCpuPtr()->clockPeriod(), event);
+            tc->getCpuPtr()->clockPeriod(), event, walk);
     } else {
         // We can't do the DMA access as there's been a problem, so tell the
         // event we're done
+        walk->descReady = true;
         event->process();
     }
 }
@@ -2601,6 +2751,10 @@ TableWalker::TableWalkerStats::TableWalkerStats(statistics::Group *parent)
              "Table walker service (enqueue to completion) latency"),
     ADD_STAT(pendingWalks, statistics::units::Tick::get(),
              "Table walker pending requests distribution"),
+    ADD_STAT(activeWalks, statistics::units::Count::get(),
+             "Table walker walks in progress when starting a walk"),
+    ADD_STAT(coalescedWalks, statistics::units::Count::get(),
+             "Table walks held back by a walk of the same page"),
     ADD_STAT(pageSizes, statistics::units::Count::get(),
              "Table walker page sizes translated"),
     ADD_STAT(requestOrigin, statistics::units::Count::get(),
@@ -2646,6 +2800,14 @@ TableWalker::TableWalkerStats::TableWalkerStats(statistics::Group *parent)
         .flags(statistics::pdf | statistics::dist | statistics::nozero |
             statistics::nonan);
 
+    activeWalks
+        .init(16)
+        .flags(statistics::pdf | statistics::dist | statistics::nozero |
+            statistics::nonan);
+
+    coalescedWalks
+        .flags(statistics::nozero);
+
     pageSizes // see DDI 0487A D4-1661
         .init(10)
         .flags(statistics::total | statistics::pdf | statistics::dist |
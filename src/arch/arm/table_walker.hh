@@ -39,6 +39,7 @@
 #define __ARCH_ARM_TABLE_WALKER_HH__
 
 #include <list>
+#include <vector>
 
 #include "arch/arm/faults.hh"
 #include "arch/arm/mmu.hh"
@@ -46,6 +47,7 @@
 #include "arch/arm/system.hh"
 #include "arch/arm/tlb.hh"
 #include "arch/arm/types.hh"
+#include "arch/arm/walk_cache_set.hh"
 #include "arch/generic/mmu.hh"
 #include "mem/packet_queue.hh"
 #include "mem/qport.hh"
@@ -921,6 +923,14 @@ class TableWalker : public ClockedObject
         /** Page entries walked during service (for stats) */
         unsigned levels;
 
+        /** Whether the descriptor being fetched in timing mode has been
+         * received and is waiting to be processed */
+        bool descReady;
+
+        /** Whether the walk has been held back by an in progress walk of
+         * the same page (for stats) */
+        bool coalesced;
+
         void doL1Descriptor();
         void doL2Descriptor();
 
@@ -936,6 +946,7 @@ class TableWalker : public ClockedObject
       public:
         Tick delay = 0;
         Event *event = nullptr;
+        WalkerState *walk = nullptr;
     };
 
     class Port : public QueuedRequestPort
@@ -949,7 +960,7 @@ class TableWalker : public ClockedObject
             uint8_t *data, Request::Flags flag, Tick delay);
         void sendTimingReq(Addr desc_addr, int size,
             uint8_t *data, Request::Flags flag, Tick delay,
-            Event *event);
+            Event *event, WalkerState *walk=nullptr);
 
         bool recvTimingResp(PacketPtr pkt) override;
 
@@ -960,7 +971,8 @@ class TableWalker : public ClockedObject
 
         PacketPtr createPacket(Addr desc_addr, int size,
                                uint8_t *data, Request::Flags flag,
-                               Tick delay, Event *event);
+                               Tick delay, Event *event,
+                               WalkerState *walk=nullptr);
 
       private:
         TableWalker& owner;
@@ -984,6 +996,7 @@ class TableWalker : public ClockedObject
         int          numBytes;
         RequestPtr   req;
         Event        *event;
+        WalkerState  *walk;
         TableWalker  &parent;
         Addr         oVAddr;
         BaseMMU::Mode mode;
@@ -993,7 +1006,7 @@ class TableWalker : public ClockedObject
         Fault fault;
 
         Stage2Walk(TableWalker &_parent, uint8_t *_data, Event *_event,
-                   Addr vaddr, BaseMMU::Mode mode,
+                   WalkerState *_walk, Addr vaddr, BaseMMU::Mode mode,
                    MMU::ArmTranslationType tran_type);
 
         void markDelayed() {}
@@ -1049,8 +1062,17 @@ class TableWalker : public ClockedObject
 
     WalkerState *currState;
 
-    /** If a timing translation is currently in progress */
-    bool pending;
+    /** Number of timing walks currently in progress */
+    unsigned activeWalks;
+
+    /** Maximum number of timing walks which can be in progress */
+    const unsigned maxActiveWalks;
+
+    /** Hold back walks to a page which is already being walked */
+    const bool coalesceWalks;
+
+    /** Dedicated page walk caches holding partial translations */
+    WalkCacheSet<TLB> walkCaches;
 
     /** The number of walks belonging to squashed instructions that can be
      * removed from the pendingQueue per cycle. */
@@ -1076,6 +1098,8 @@ class TableWalker : public ClockedObject
         statistics::Histogram walkServiceTime;
         // Essentially "L" of queueing theory
         statistics::Histogram pendingWalks;
+        statistics::Histogram activeWalks;
+        statistics::Scalar coalescedWalks;
         statistics::Vector pageSizes;
         statistics::Vector2d requestOrigin;
     } stats;
@@ -1113,6 +1137,13 @@ class TableWalker : public ClockedObject
     void setMmu(MMU *_mmu);
     void setTlb(TLB *_tlb) { tlb = _tlb; }
     TLB* getTlb() { return tlb; }
+
+    /** Set the VMID the page walk cache entries are matched against */
+    void setWalkCachesVMID(vmid_t vmid) { walkCaches.setVMID(vmid); }
+    /** Invalidate the page walk cache entries matching a TLBI op */
+    void flushWalkCaches(const TLBIOp &tlbi_op);
+    /** Invalidate all the page walk cache entries */
+    void flushWalkCaches();
     void memAttrs(ThreadContext *tc, TlbEntry &te, SCTLR sctlr,
                   uint8_t texcb, bool s);
     void memAttrsLPAE(ThreadContext *tc, TlbEntry &te,
@@ -1146,6 +1177,26 @@ class TableWalker : public ClockedObject
     void doLongDescriptorWrapper(LookupLevel curr_lookup_level);
     Event* LongDescEventByLevel[4];
 
+    /** Select the walk waiting at the given level whose descriptor
+     * has been received (the oldest one if none is marked as such) */
+    WalkerState *readyWalk(LookupLevel lookup_level);
+
+    /** Reschedule the descriptor event of a level if other walks
+     * waiting at that level have received their descriptor */
+    void scheduleReadyWalks(LookupLevel lookup_level, Event *event);
+
+    /** Whether a walk of the same page as walk is in progress */
+    bool walkInProgress(const WalkerState *walk) const;
+
+    /** Return the first pending walk, starting from it, which is not
+     * held back by an in progress walk of the same page */
+    std::list<WalkerState *>::iterator
+    nextPendingWalk(std::list<WalkerState *>::iterator it);
+
+    /** Look the current walk up in the page walk caches, possibly
+     * allowing it to skip some lookup levels */
+    void lookupWalkCaches();
+
     bool fetchDescriptor(Addr descAddr, uint8_t *data, int numBytes,
         Request::Flags flags, int queueIndex, Event *event,
         void (TableWalker::*doDescriptor)());
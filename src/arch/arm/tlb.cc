@@ -47,6 +47,7 @@
 #include "arch/arm/table_walker.hh"
 #include "arch/arm/tlbi_op.hh"
 #include "arch/arm/utility.hh"
+#include "base/intmath.hh"
 #include "base/trace.hh"
 #include "cpu/thread_context.hh"
 #include "debug/TLB.hh"
@@ -60,11 +61,33 @@ using namespace ArmISA;
 
 TLB::TLB(const ArmTLBParams &p)
     : BaseTLB(p), table(new TlbEntry[p.size]), size(p.size),
+      assoc(p.assoc), numSets(1), replEntries(p.size),
+      replacementPolicy(p.replacement_policy),
+      pageShiftCount{}, pageShifts(0),
       isStage2(p.is_stage2),
       _walkCache(false),
       tableWalker(nullptr),
-      stats(*this), rangeMRU(1), vmid(0)
+      stats(*this), vmid(0)
 {
+    fatal_if(assoc <= 0 || size % assoc != 0,
+             "%s: TLB associativity (%d) must divide the TLB size (%d)\n",
+             name(), assoc, size);
+    numSets = size / assoc;
+    fatal_if(!isPowerOf2(numSets),
+             "%s: number of TLB sets (%d) must be a power of 2\n",
+             name(), numSets);
+
+    sets.resize(numSets);
+    for (int set = 0; set < numSets; ++set) {
+        for (int way = 0; way < assoc; ++way) {
+            ReplaceableEntry &repl_entry = replEntries[set * assoc + way];
+            repl_entry.setPosition(set, way);
+            repl_entry.replacementData =
+                replacementPolicy->instantiateEntry();
+            sets[set].push_back(&repl_entry);
+        }
+    }
+
     for (int lvl = LookupLevel::L0;
          lvl < LookupLevel::Num_ArmLookupLevel; lvl++) {
 
@@ -105,49 +128,52 @@ TLB::setTableWalker(TableWalker *table_walker)
 TlbEntry*
 TLB::match(const Lookup &lookup_data)
 {
-    // Vector of TLB entry candidates.
-    // Only one of them will be assigned to retval and will
-    // be returned to the MMU (in case of a hit)
-    // The vector has one entry per lookup level as it stores
+    // Index of the TLB entry candidates.
+    // Only one of them will be returned to the MMU (in case of a hit)
+    // The array has one entry per lookup level as it stores
     // both complete and partial matches
-    std::vector<std::pair<int, const TlbEntry*>> hits{
-        LookupLevel::Num_ArmLookupLevel, {0, nullptr}};
+    std::array<int, LookupLevel::Num_ArmLookupLevel> hits;
+    hits.fill(-1);
 
-    int x = 0;
-    while (x < size) {
-        if (table[x].match(lookup_data)) {
-            const TlbEntry &entry = table[x];
-            hits[entry.lookupLevel] = std::make_pair(x, &entry);
+    auto check_entry = [&](int idx)
+    {
+        const TlbEntry &entry = table[idx];
+        if (entry.match(lookup_data)) {
+            hits[entry.lookupLevel] = idx;
 
             // This is a complete translation, no need to loop further
-            if (!entry.partial)
+            return !entry.partial;
+        }
+        return false;
+    };
+
+    if (lookup_data.size) {
+        // A range based lookup may span several pages (and therefore
+        // sets): check every entry
+        for (int idx = 0; idx < size; ++idx) {
+            if (check_entry(idx))
                 break;
         }
-        ++x;
+    } else {
+        forEachCandidate(lookup_data.va, check_entry);
     }
 
     // Loop over the list of TLB entries matching our translation
     // request, starting from the highest lookup level (complete
     // translation) and iterating backwards (using reverse iterators)
     for (auto it = hits.rbegin(); it != hits.rend(); it++) {
-        const auto& [idx, entry] = *it;
-        if (!entry) {
+        const int idx = *it;
+        if (idx < 0) {
             // No match for the current LookupLevel
             continue;
         }
 
-        // Maintaining LRU array
-        // We only move the hit entry ahead when the position is higher
-        // than rangeMRU
-        if (idx > rangeMRU && !lookup_data.functional) {
-            TlbEntry tmp_entry = *entry;
-            for (int i = idx; i > 0; i--)
-                table[i] = table[i - 1];
-            table[0] = tmp_entry;
-            return &table[0];
-        } else {
-            return &table[idx];
+        // Entries stay in place, only their replacement state is
+        // updated on a hit
+        if (!lookup_data.functional) {
+            replacementPolicy->touch(replEntries[idx].replacementData);
         }
+        return &table[idx];
     }
 
     return nullptr;
@@ -248,19 +274,29 @@ TLB::insert(TlbEntry &entry)
             entry.ap, static_cast<uint8_t>(entry.domain), entry.ns, entry.nstid,
             entry.isHyp);
 
-    if (table[size - 1].valid)
+    // Place the entry in the set selected by its own virtual page
+    // number and evict the victim chosen by the replacement policy
+    const int set = numSets == 1 ? 0 : setIndex(entry.vpn << entry.N,
+                                                entry.N);
+    auto *repl_victim = replacementPolicy->getVictim(sets[set]);
+    const int idx = repl_victim->getSet() * assoc + repl_victim->getWay();
+    TlbEntry &victim = table[idx];
+
+    if (victim.valid) {
         DPRINTF(TLB, " - Replacing Valid entry %#x, asn %d vmn %d ppn %#x "
                 "size: %#x ap:%d ns:%d nstid:%d g:%d isHyp:%d el: %d\n",
-                table[size-1].vpn << table[size-1].N, table[size-1].asid,
-                table[size-1].vmid, table[size-1].pfn << table[size-1].N,
-                table[size-1].size, table[size-1].ap, table[size-1].ns,
-                table[size-1].nstid, table[size-1].global, table[size-1].isHyp,
-                table[size-1].el);
+                victim.vpn << victim.N, victim.asid, victim.vmid,
+                victim.pfn << victim.N, victim.size, victim.ap, victim.ns,
+                victim.nstid, victim.global, victim.isHyp, victim.el);
+        invalidateEntry(idx);
+    }
 
-    // inserting to MRU position and evicting the LRU one
-    for (int i = size - 1; i > 0; --i)
-        table[i] = table[i-1];
-    table[0] = entry;
+    victim = entry;
+    if (victim.valid) {
+        if (pageShiftCount[victim.N]++ == 0)
+            pageShifts |= ULL(1) << victim.N;
+    }
+    replacementPolicy->reset(repl_victim->replacementData);
 
     stats.inserts++;
     ppRefills->notify(1);
@@ -298,17 +334,14 @@ void
 TLB::flushAll()
 {
     DPRINTF(TLB, "Flushing all TLB entries\n");
-    int x = 0;
-    TlbEntry *te;
-    while (x < size) {
-        te = &table[x];
+    for (int x = 0; pageShifts && x < size; ++x) {
+        TlbEntry *te = &table[x];
 
         if (te->valid) {
             DPRINTF(TLB, " -  %s\n", te->print());
-            te->valid = false;
+            invalidateEntry(x);
             stats.flushedEntries++;
         }
-        ++x;
     }
 
     stats.flushTlb++;
@@ -317,21 +350,42 @@ TLB::flushAll()
 void
 TLB::flush(const TLBIOp& tlbi_op)
 {
-    int x = 0;
-    TlbEntry *te;
-    while (x < size) {
-        te = &table[x];
-        if (tlbi_op.match(te, vmid)) {
+    auto flush_entry = [&](int idx)
+    {
+        TlbEntry *te = &table[idx];
+        if (te->valid && tlbi_op.match(te, vmid)) {
             DPRINTF(TLB, " -  %s\n", te->print());
-            te->valid = false;
+            invalidateEntry(idx);
             stats.flushedEntries++;
         }
-        ++x;
+        return false;
+    };
+
+    if (auto va = tlbi_op.targetVa()) {
+        // Operations targeting a single VA only need to search the
+        // sets that VA maps to
+        forEachCandidate(*va, flush_entry);
+    } else {
+        for (int x = 0; pageShifts && x < size; ++x)
+            flush_entry(x);
     }
 
     stats.flushTlb++;
 }
 
+void
+TLB::invalidateEntry(int idx)
+{
+    TlbEntry &te = table[idx];
+    assert(te.valid);
+
+    te.valid = false;
+    if (--pageShiftCount[te.N] == 0)
+        pageShifts &= ~(ULL(1) << te.N);
+
+    replacementPolicy->invalidate(replEntries[idx].replacementData);
+}
+
 void
 TLB::takeOverFrom(BaseTLB *_otlb)
 {
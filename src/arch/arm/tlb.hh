@@ -41,13 +41,18 @@
 #ifndef __ARCH_ARM_TLB_HH__
 #define __ARCH_ARM_TLB_HH__
 
+#include <array>
+#include <vector>
 
 #include "arch/arm/faults.hh"
 #include "arch/arm/pagetable.hh"
 #include "arch/arm/utility.hh"
 #include "arch/generic/tlb.hh"
+#include "base/bitfield.hh"
 #include "base/statistics.hh"
 #include "enums/TypeTLB.hh"
+#include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/replacement_policies/replaceable_entry.hh"
 #include "mem/request.hh"
 #include "params/ArmTLB.hh"
 #include "sim/probe/pmu.hh"
@@ -107,6 +112,32 @@ class TLB : public BaseTLB
     /** TLB Size */
     int size;
 
+    /** TLB associativity (size for a fully associative TLB) */
+    int assoc;
+
+    /** Number of sets; table entries are laid out as set * assoc + way */
+    int numSets;
+
+    /**
+     * Replacement state of the table entries (same indexing as the
+     * table), and the per-set candidate lists handed to the policy
+     */
+    std::vector<ReplaceableEntry> replEntries;
+    std::vector<ReplacementCandidates> sets;
+
+    /** Replacement policy used to select a victim within a set */
+    replacement_policy::Base *replacementPolicy;
+
+    /**
+     * Number of valid entries per page size, indexed by TlbEntry::N.
+     * An entry is placed in the set selected by its own virtual page
+     * number, so a lookup only probes one set per cached page size.
+     */
+    std::array<unsigned, 64> pageShiftCount;
+
+    /** Bitmask of the page sizes (N) having at least one valid entry */
+    uint64_t pageShifts;
+
     /** Indicates this TLB caches IPA->PA translations */
     bool isStage2;
 
@@ -153,7 +184,6 @@ class TLB : public BaseTLB
     /** PMU probe for TLB refills */
     probing::PMUUPtr ppRefills;
 
-    int rangeMRU; //On lookup, only move entries ahead when outside rangeMRU
     vmid_t vmid;
 
   public:
@@ -287,6 +317,43 @@ class TLB : public BaseTLB
     /** Helper function looking up for a matching TLB entry
      * Does not update stats; see lookup method instead */
     TlbEntry *match(const Lookup &lookup_data);
+
+    /** Set a VA maps to when cached with a page size of 2^page_shift */
+    int
+    setIndex(Addr va, unsigned page_shift) const
+    {
+        return (va >> page_shift) & (numSets - 1);
+    }
+
+    /**
+     * Apply func to the index of every table entry which could hold a
+     * translation for va: the whole table for a fully associative TLB
+     * and one set per cached page size otherwise. Iteration stops as
+     * soon as func returns true.
+     */
+    template <typename Func>
+    void
+    forEachCandidate(Addr va, Func func) const
+    {
+        if (numSets == 1) {
+            for (int idx = 0; idx < size; ++idx) {
+                if (func(idx))
+                    return;
+            }
+            return;
+        }
+
+        for (uint64_t shifts = pageShifts; shifts; shifts &= shifts - 1) {
+            const int first = setIndex(va, ctz64(shifts)) * assoc;
+            for (int idx = first; idx < first + assoc; ++idx) {
+                if (func(idx))
+                    return;
+            }
+        }
+    }
+
+    /** Invalidate the table entry at idx, updating the occupancy info */
+    void invalidateEntry(int idx);
 };
 
 } // namespace ArmISA
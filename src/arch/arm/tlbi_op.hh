@@ -38,6 +38,8 @@
 #ifndef __ARCH_ARM_TLBI_HH__
 #define __ARCH_ARM_TLBI_HH__
 
+#include <optional>
+
 #include "arch/arm/system.hh"
 #include "arch/arm/tlb.hh"
 #include "cpu/thread_context.hh"
@@ -78,6 +80,19 @@ class TLBIOp
 
     virtual bool match(TlbEntry *entry, vmid_t curr_vmid) const = 0;
 
+    /**
+     * Return the virtual address targeted by the operation if it only
+     * invalidates the translations of a single VA. This allows a
+     * set associative TLB to search the sets the VA maps to rather
+     * than the whole table. Defaulting to no address in the TLBIOp
+     * abstract class
+     */
+    virtual std::optional<Addr>
+    targetVa() const
+    {
+        return std::nullopt;
+    }
+
     /**
      * Return true if the TLBI op needs to flush stage1
      * entries, Defaulting to true in the TLBIOp abstract
@@ -313,6 +328,12 @@ class TLBIMVAA : public TLBIOp
 
     bool match(TlbEntry *entry, vmid_t curr_vmid) const override;
 
+    std::optional<Addr>
+    targetVa() const override
+    {
+        return sext<56>(addr);
+    }
+
     Addr addr;
     bool inHost;
     bool lastLevel;
@@ -335,6 +356,12 @@ class TLBIMVA : public TLBIOp
 
     bool match(TlbEntry *entry, vmid_t curr_vmid) const override;
 
+    std::optional<Addr>
+    targetVa() const override
+    {
+        return sext<56>(addr);
+    }
+
     Addr addr;
     uint16_t asid;
     bool inHost;
@@ -473,6 +500,13 @@ class TLBIRMVA : public TLBIRange, public TLBIMVA
     {}
 
     bool match(TlbEntry *entry, vmid_t curr_vmid) const override;
+
+    std::optional<Addr>
+    targetVa() const override
+    {
+        // A range may span several pages
+        return std::nullopt;
+    }
 };
 
 /** TLB Range Invalidate by VA, All ASIDs */
@@ -486,6 +520,13 @@ class TLBIRMVAA : public TLBIRange, public TLBIMVAA
     {}
 
     bool match(TlbEntry *entry, vmid_t curr_vmid) const override;
+
+    std::optional<Addr>
+    targetVa() const override
+    {
+        // A range may span several pages
+        return std::nullopt;
+    }
 };
 
 /** TLB Range Invalidate by VA, All ASIDs */
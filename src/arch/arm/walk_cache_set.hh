@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ARCH_ARM_WALK_CACHE_SET_HH__
+#define __ARCH_ARM_WALK_CACHE_SET_HH__
+
+#include <vector>
+
+namespace gem5
+{
+
+namespace ArmISA
+{
+
+/**
+ * The dedicated page walk caches of a table walker. They are TLBs
+ * holding partial translations, which must follow the VMID of the
+ * translation context like the other TLBs do, since TLBI operations
+ * match the cached entries against it.
+ */
+template <class Tlb>
+class WalkCacheSet
+{
+  public:
+    template <class Iter>
+    WalkCacheSet(Iter begin, Iter end) : caches(begin, end) {}
+
+    bool empty() const { return caches.empty(); }
+
+    template <class Vmid>
+    void
+    setVMID(Vmid vmid)
+    {
+        for (auto cache : caches)
+            cache->setVMID(vmid);
+    }
+
+    /** Insert a partial translation in all the caches */
+    template <class Entry>
+    void
+    insert(Entry &entry)
+    {
+        for (auto cache : caches)
+            cache->multiInsert(entry);
+    }
+
+    /**
+     * Look a partial translation up, updating best if a cache holds one
+     * skipping more lookup levels.
+     */
+    template <class Lookup, class Entry>
+    void
+    lookup(const Lookup &lookup_data, Entry &best)
+    {
+        for (auto cache : caches) {
+            Entry *entry = cache->lookup(lookup_data);
+            if (entry && entry->partial && (!best.valid ||
+                    entry->lookupLevel > best.lookupLevel)) {
+                best = *entry;
+            }
+        }
+    }
+
+    /** Invalidate the entries matching a TLBI operation */
+    template <class Op>
+    void
+    flush(const Op &tlbi_op)
+    {
+        for (auto cache : caches)
+            cache->flush(tlbi_op);
+    }
+
+    void
+    flushAll()
+    {
+        for (auto cache : caches)
+            cache->flushAll();
+    }
+
+  private:
+    std::vector<Tlb *> caches;
+};
+
+} // namespace ArmISA
+} // namespace gem5
+
+#endif // __ARCH_ARM_WALK_CACHE_SET_HH__
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "arch/arm/walk_cache_set.hh"
+
+using namespace gem5::ArmISA;
+
+namespace
+{
+
+struct TestEntry
+{
+    bool valid = false;
+    bool partial = true;
+    int lookupLevel = 0;
+    uint64_t va = 0;
+    uint16_t vmid = 0;
+};
+
+struct TestLookup
+{
+    uint64_t va;
+    uint16_t vmid;
+};
+
+/** Invalidates the entries of the current VMID, like TLBI VMALLE1 */
+struct TestVmallOp
+{
+    bool
+    match(const TestEntry *entry, uint16_t curr_vmid) const
+    {
+        return entry->vmid == curr_vmid;
+    }
+};
+
+/** The parts of a TLB used by WalkCacheSet */
+class TestTlb
+{
+  public:
+    void setVMID(uint16_t _vmid) { vmid = _vmid; }
+
+    void
+    multiInsert(TestEntry &entry)
+    {
+        entries.push_back(entry);
+        entries.back().valid = true;
+    }
+
+    TestEntry *
+    lookup(const TestLookup &lookup_data)
+    {
+        for (auto &entry : entries) {
+            if (entry.valid && entry.va == lookup_data.va &&
+                entry.vmid == lookup_data.vmid) {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    template <class Op>
+    void
+    flush(const Op &tlbi_op)
+    {
+        for (auto &entry : entries) {
+            if (entry.valid && tlbi_op.match(&entry, vmid))
+                entry.valid = false;
+        }
+    }
+
+    void
+    flushAll()
+    {
+        for (auto &entry : entries)
+            entry.valid = false;
+    }
+
+    int
+    numValid() const
+    {
+        int count = 0;
+        for (const auto &entry : entries)
+            count += entry.valid;
+        return count;
+    }
+
+    uint16_t vmid = 0;
+    std::vector<TestEntry> entries;
+};
+
+TestEntry
+makeEntry(uint64_t va, uint16_t vmid, int level=1, bool partial=true)
+{
+    TestEntry entry;
+    entry.va = va;
+    entry.vmid = vmid;
+    entry.lookupLevel = level;
+    entry.partial = partial;
+    return entry;
+}
+
+} // anonymous namespace
+
+TEST(WalkCacheSet, Empty)
+{
+    std::vector<TestTlb *> none;
+    EXPECT_TRUE(WalkCacheSet<TestTlb>(none.begin(), none.end()).empty());
+}
+
+TEST(WalkCacheSet, SetVMID)
+{
+    TestTlb a, b;
+    std::vector<TestTlb *> tlbs = {&a, &b};
+    WalkCacheSet<TestTlb> caches(tlbs.begin(), tlbs.end());
+    EXPECT_FALSE(caches.empty());
+
+    caches.setVMID(5);
+    EXPECT_EQ(5, a.vmid);
+    EXPECT_EQ(5, b.vmid);
+}
+
+/**
+ * Entries cached for a guest with a non-zero VMID must be invalidated by
+ * the TLBI operations of that guest, which are matched against the VMID
+ * of the caches.
+ */
+TEST(WalkCacheSet, FlushMatchesContextVMID)
+{
+    TestTlb a, b;
+    std::vector<TestTlb *> tlbs = {&a, &b};
+    WalkCacheSet<TestTlb> caches(tlbs.begin(), tlbs.end());
+
+    auto guest = makeEntry(0x1000, 3);
+    auto other = makeEntry(0x2000, 4);
+    caches.insert(guest);
+    caches.insert(other);
+
+    caches.setVMID(3);
+    caches.flush(TestVmallOp());
+    for (auto tlb : tlbs) {
+        EXPECT_EQ(nullptr, tlb->lookup({0x1000, 3}));
+        EXPECT_NE(nullptr, tlb->lookup({0x2000, 4}));
+    }
+
+    caches.flushAll();
+    EXPECT_EQ(0, a.numValid());
+    EXPECT_EQ(0, b.numValid());
+}
+
+TEST(WalkCacheSet, LookupKeepsDeepestPartial)
+{
+    TestTlb a, b, c;
+    std::vector<TestTlb *> tlbs = {&a, &b, &c};
+    WalkCacheSet<TestTlb> caches(tlbs.begin(), tlbs.end());
+
+    auto shallow = makeEntry(0x1000, 1, 1);
+    auto deep = makeEntry(0x1000, 1, 2);
+    auto leaf = makeEntry(0x1000, 1, 3, false);
+    a.multiInsert(shallow);
+    b.multiInsert(deep);
+    c.multiInsert(leaf);
+
+    TestEntry best;
+    caches.lookup(TestLookup{0x1000, 1}, best);
+    EXPECT_TRUE(best.valid);
+    EXPECT_EQ(2, best.lookupLevel);
+
+    // A hit in the walk caches doesn't replace a deeper existing one
+    best = deep;
+    best.valid = true;
+    best.lookupLevel = 3;
+    caches.lookup(TestLookup{0x1000, 1}, best);
+    EXPECT_EQ(3, best.lookupLevel);
+
+    TestEntry miss;
+    caches.lookup(TestLookup{0x1000, 2}, miss);
+    EXPECT_FALSE(miss.valid);
+}
@@ -39,17 +39,29 @@ namespace gem5
 namespace GenericISA
 {
 
+/**
+ * A decode cache shared by all the decoders of an ISA. Decoded
+ * instructions are kept in a concurrent hash, and the per address
+ * cache in front of it is private to each host thread, so that CPUs
+ * simulated by different event queues can safely share it.
+ */
 template <typename Decoder, typename EMI>
 class BasicDecodeCache
 {
   private:
-    decode_cache::InstMap<EMI> instMap;
+    decode_cache::SharedInstMap<EMI> instMap;
     struct AddrMapEntry
     {
         StaticInstPtr inst;
         EMI machInst;
     };
-    decode_cache::AddrMap<AddrMapEntry> decodePages;
+
+    static decode_cache::AddrMap<AddrMapEntry> &
+    decodePages()
+    {
+        static thread_local decode_cache::AddrMap<AddrMapEntry> pages;
+        return pages;
+    }
 
   public:
     /// Decode a machine instruction.
@@ -58,20 +70,16 @@ class BasicDecodeCache
     StaticInstPtr
     decode(Decoder *const decoder, EMI mach_inst, Addr addr)
     {
-        auto &entry = decodePages.lookup(addr);
+        auto &entry = decodePages().lookup(addr);
         if (entry.inst && (entry.machInst == mach_inst))
             return entry.inst;
 
         entry.machInst = mach_inst;
 
-        auto iter = instMap.find(mach_inst);
-        if (iter != instMap.end()) {
-            entry.inst = iter->second;
-            return entry.inst;
-        }
-
-        entry.inst = decoder->decodeInst(mach_inst);
-        instMap[mach_inst] = entry.inst;
+        entry.inst = instMap.find(mach_inst);
+        if (!entry.inst)
+            entry.inst = instMap.insert(mach_inst,
+                                        decoder->decodeInst(mach_inst));
         return entry.inst;
     }
 };
@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __ARCH_GENERIC_SET_ASSOC_TLB_HH__
+#define __ARCH_GENERIC_SET_ASSOC_TLB_HH__
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "base/types.hh"
+#include "mem/cache/replacement_policies/replaceable_entry.hh"
+
+namespace gem5
+{
+
+namespace replacement_policy
+{
+    class Base;
+}
+
+/**
+ * Set associative storage for the entries of a TLB. Invalid entries are
+ * filled first; the victim within a full set is chosen by a replacement
+ * policy.
+ *
+ * Entries are tagged with a key (usually a virtual address, possibly
+ * concatenated with an address space identifier) and cover
+ * 2^logBytes bytes of it, so that pages of different sizes can be
+ * resident at the same time. An entry is placed in the set selected
+ * by the key bits right above its page offset: a lookup therefore
+ * probes one set per page size currently resident in the TLB, from
+ * the smallest to the largest one.
+ *
+ * The Entry type must provide a logBytes (page size, in address bits)
+ * and an lruSeq member. The latter records the order in which the
+ * entries were last used, so that checkpoints can rebuild the state of
+ * the replacement policy (see restore()).
+ */
+template <class Entry, class Policy=replacement_policy::Base>
+class SetAssocTlb
+{
+  public:
+    /**
+     * @param size Number of entries
+     * @param assoc Number of entries per set; size makes the TLB
+     *              fully associative
+     * @param policy Replacement policy used within a set
+     */
+    SetAssocTlb(size_t size, size_t assoc, Policy *policy)
+      : entries(size), keys(size, 0), valid(size, false),
+        replEntries(size), policy(policy),
+        assoc(assoc), numSets(assoc ? size / assoc : 0)
+    {
+        fatal_if(!size, "TLBs must have a non-zero size.\n");
+        fatal_if(!assoc || numSets * assoc != size,
+                 "TLB associativity (%d) must divide its size (%d).\n",
+                 assoc, size);
+        fatal_if(!isPowerOf2(numSets),
+                 "The number of TLB sets (%d) must be a power of 2.\n",
+                 numSets);
+        fatal_if(!policy, "TLBs must have a replacement policy.\n");
+
+        sets.resize(numSets);
+        for (size_t idx = 0; idx < size; idx++) {
+            replEntries[idx].setPosition(idx / assoc, idx % assoc);
+            replEntries[idx].replacementData = policy->instantiateEntry();
+            sets[idx / assoc].push_back(&replEntries[idx]);
+        }
+    }
+
+    /**
+     * Look the entry covering key up.
+     *
+     * @param update_lru Whether the replacement state of the entry
+     *                   should be updated on a hit
+     * @return The matching entry, nullptr on a miss
+     */
+    Entry *
+    lookup(Addr key, bool update_lru=true)
+    {
+        for (uint64_t shifts = pageShifts; shifts; shifts &= shifts - 1) {
+            const unsigned shift = ctz64(shifts);
+            const Addr tag = key >> shift;
+            const size_t first = setIndex(key, shift) * assoc;
+            for (size_t idx = first; idx < first + assoc; idx++) {
+                if (valid[idx] && entries[idx].logBytes == shift &&
+                    keys[idx] >> shift == tag) {
+                    if (update_lru) {
+                        entries[idx].lruSeq = nextSeq();
+                        policy->touch(replEntries[idx].replacementData);
+                    }
+                    return &entries[idx];
+                }
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * Insert a copy of entry, tagged with key, replacing the victim
+     * chosen by the replacement policy if its set is full. The caller
+     * is responsible for not inserting duplicates.
+     *
+     * @return The inserted entry
+     */
+    Entry *
+    insert(Addr key, const Entry &entry)
+    {
+        Entry *inserted = place(key, entry);
+        inserted->lruSeq = nextSeq();
+        return inserted;
+    }
+
+    /**
+     * Restore entries saved by a checkpoint, keeping their lruSeq. They
+     * are inserted from the least to the most recently used one, which
+     * rebuilds the state of recency based replacement policies.
+     *
+     * @param saved The (key, entry) pairs to restore
+     * @param last_seq The lastSeq() of the TLB the entries were saved from
+     */
+    void
+    restore(std::vector<std::pair<Addr, Entry>> saved, uint64_t last_seq)
+    {
+        std::stable_sort(saved.begin(), saved.end(),
+            [](const auto &a, const auto &b) {
+                return a.second.lruSeq < b.second.lruSeq;
+            });
+        for (const auto &[key, entry] : saved)
+            place(key, entry);
+        lruSeq = last_seq;
+    }
+
+    /** The lruSeq of the most recently used entry */
+    uint64_t lastSeq() const { return lruSeq; }
+
+    /** Remove an entry previously returned by lookup or insert */
+    void
+    remove(Entry *entry)
+    {
+        const size_t idx = entry - entries.data();
+        assert(idx < entries.size() && valid[idx]);
+        invalidate(idx);
+    }
+
+    /** Remove every entry for which pred(entry) returns true */
+    template <class Pred>
+    void
+    removeIf(Pred pred)
+    {
+        for (size_t idx = 0; idx < entries.size(); idx++) {
+            if (valid[idx] && pred(entries[idx]))
+                invalidate(idx);
+        }
+    }
+
+    /** Call func(entry) on every valid entry */
+    template <class Func>
+    void
+    forEach(Func func) const
+    {
+        for (size_t idx = 0; idx < entries.size(); idx++) {
+            if (valid[idx])
+                func(entries[idx]);
+        }
+    }
+
+    /** Remove all the entries */
+    void
+    flushAll()
+    {
+        removeIf([](const Entry &) { return true; });
+    }
+
+    /** The key the entry has been inserted with */
+    Addr
+    key(const Entry *entry) const
+    {
+        return keys[entry - entries.data()];
+    }
+
+    size_t size() const { return entries.size(); }
+
+    /** Number of valid entries */
+    size_t occupancy() const { return occupied; }
+
+  private:
+    size_t
+    setIndex(Addr key, unsigned shift) const
+    {
+        return (key >> shift) & (numSets - 1);
+    }
+
+    uint64_t nextSeq() { return ++lruSeq; }
+
+    /** Copy entry into its set, leaving its lruSeq untouched */
+    Entry *
+    place(Addr key, const Entry &entry)
+    {
+        assert(entry.logBytes < 64);
+
+        const size_t set = setIndex(key, entry.logBytes);
+        const size_t first = set * assoc;
+        size_t victim = first + assoc;
+        for (size_t idx = first; idx < first + assoc; idx++) {
+            if (!valid[idx]) {
+                victim = idx;
+                break;
+            }
+        }
+        if (victim == first + assoc) {
+            victim = first + policy->getVictim(sets[set])->getWay();
+            invalidate(victim);
+        }
+
+        entries[victim] = entry;
+        keys[victim] = key;
+        valid[victim] = true;
+        if (pageShiftCount[entry.logBytes]++ == 0)
+            pageShifts |= 1ULL << entry.logBytes;
+        occupied++;
+        policy->reset(replEntries[victim].replacementData);
+
+        return &entries[victim];
+    }
+
+    void
+    invalidate(size_t idx)
+    {
+        const unsigned shift = entries[idx].logBytes;
+        if (--pageShiftCount[shift] == 0)
+            pageShifts &= ~(1ULL << shift);
+        valid[idx] = false;
+        occupied--;
+        policy->invalidate(replEntries[idx].replacementData);
+    }
+
+    std::vector<Entry> entries;
+    std::vector<Addr> keys;
+    std::vector<bool> valid;
+
+    /** Replacement state of each entry, and the candidates of each set */
+    std::vector<ReplaceableEntry> replEntries;
+    std::vector<std::vector<ReplaceableEntry *>> sets;
+    Policy *policy;
+
+    const size_t assoc;
+    const size_t numSets;
+
+    /** Number of valid entries per page size */
+    std::array<unsigned, 64> pageShiftCount = {};
+    /** Bitmask of the page sizes with valid entries */
+    uint64_t pageShifts = 0;
+
+    size_t occupied = 0;
+    uint64_t lruSeq = 0;
+};
+
+} // namespace gem5
+
+#endif // __ARCH_GENERIC_SET_ASSOC_TLB_HH__
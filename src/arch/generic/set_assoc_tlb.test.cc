@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+
+#include "arch/generic/set_assoc_tlb.hh"
+#include "mem/cache/replacement_policies/recency_list.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+struct TestEntry
+{
+    Addr paddr = 0;
+    unsigned logBytes = 12;
+    uint64_t lruSeq = 0;
+};
+
+TestEntry
+makeEntry(Addr paddr, unsigned log_bytes=12)
+{
+    TestEntry entry;
+    entry.paddr = paddr;
+    entry.logBytes = log_bytes;
+    return entry;
+}
+
+/**
+ * An LRU policy with the interface of replacement_policy::Base, which
+ * can't be instantiated outside of a simulation.
+ */
+class TestLRU
+{
+  public:
+    struct Data : replacement_policy::ReplacementData
+    {
+        uint64_t stamp = 0;
+    };
+
+    std::shared_ptr<replacement_policy::ReplacementData>
+    instantiateEntry()
+    {
+        return std::make_shared<Data>();
+    }
+
+    void
+    invalidate(const std::shared_ptr<replacement_policy::ReplacementData> &)
+    {
+    }
+
+    void
+    touch(const std::shared_ptr<replacement_policy::ReplacementData> &data)
+    {
+        auto &stamp = std::static_pointer_cast<Data>(data)->stamp;
+        stamp = order.touch(stamp);
+    }
+
+    void
+    reset(const std::shared_ptr<replacement_policy::ReplacementData> &data)
+    {
+        std::static_pointer_cast<Data>(data)->stamp = order.moveToHead();
+    }
+
+    ReplaceableEntry *
+    getVictim(const std::vector<ReplaceableEntry *> &candidates)
+    {
+        return *std::min_element(candidates.begin(), candidates.end(),
+            [](ReplaceableEntry *a, ReplaceableEntry *b) {
+                return stamp(a) < stamp(b);
+            });
+    }
+
+  private:
+    static uint64_t
+    stamp(ReplaceableEntry *entry)
+    {
+        return std::static_pointer_cast<Data>(entry->replacementData)->stamp;
+    }
+
+    replacement_policy::RecencyList order;
+};
+
+typedef SetAssocTlb<TestEntry, TestLRU> TestTlb;
+
+} // anonymous namespace
+
+TEST(SetAssocTlb, LookupMiss)
+{
+    TestLRU lru;
+    TestTlb tlb(16, 4, &lru);
+    ASSERT_EQ(nullptr, tlb.lookup(0x1000));
+    ASSERT_EQ(0, tlb.occupancy());
+}
+
+TEST(SetAssocTlb, LookupHit)
+{
+    TestLRU lru;
+    TestTlb tlb(16, 4, &lru);
+    tlb.insert(0x1000, makeEntry(0x8000));
+
+    TestEntry *entry = tlb.lookup(0x1abc);
+    ASSERT_NE(nullptr, entry);
+    ASSERT_EQ(0x8000, entry->paddr);
+    ASSERT_EQ(0x1000, tlb.key(entry));
+    ASSERT_EQ(nullptr, tlb.lookup(0x2000));
+}
+
+TEST(SetAssocTlb, HugePages)
+{
+    TestLRU lru;
+    TestTlb tlb(16, 4, &lru);
+    tlb.insert(0x200000, makeEntry(0x40000000, 21));
+    tlb.insert(0x1000, makeEntry(0x8000));
+
+    TestEntry *entry = tlb.lookup(0x3fffff);
+    ASSERT_NE(nullptr, entry);
+    ASSERT_EQ(0x40000000, entry->paddr);
+    ASSERT_EQ(21, entry->logBytes);
+
+    entry = tlb.lookup(0x1fff);
+    ASSERT_NE(nullptr, entry);
+    ASSERT_EQ(0x8000, entry->paddr);
+
+    ASSERT_EQ(nullptr, tlb.lookup(0x400000));
+}
+
+TEST(SetAssocTlb, SmallestPageFirst)
+{
+    TestLRU lru;
+    TestTlb tlb(16, 4, &lru);
+    tlb.insert(0x0, makeEntry(0x40000000, 21));
+    tlb.insert(0x1000, makeEntry(0x8000));
+
+    TestEntry *entry = tlb.lookup(0x1000);
+    ASSERT_NE(nullptr, entry);
+    ASSERT_EQ(0x8000, entry->paddr);
+}
+
+TEST(SetAssocTlb, LRUReplacement)
+{
+    // Two sets of two entries, pages 0x0000, 0x2000, 0x4000 map to set 0
+    TestLRU lru;
+    TestTlb tlb(4, 2, &lru);
+    tlb.insert(0x0000, makeEntry(0x10000));
+    tlb.insert(0x2000, makeEntry(0x20000));
+
+    // Make 0x0000 the most recently used entry of the set
+    ASSERT_NE(nullptr, tlb.lookup(0x0000));
+
+    tlb.insert(0x4000, makeEntry(0x30000));
+    ASSERT_NE(nullptr, tlb.lookup(0x0000));
+    ASSERT_EQ(nullptr, tlb.lookup(0x2000));
+    ASSERT_NE(nullptr, tlb.lookup(0x4000));
+    ASSERT_EQ(2, tlb.occupancy());
+
+    // The other set is untouched
+    tlb.insert(0x1000, makeEntry(0x40000));
+    ASSERT_EQ(3, tlb.occupancy());
+    ASSERT_NE(nullptr, tlb.lookup(0x0000));
+    ASSERT_NE(nullptr, tlb.lookup(0x4000));
+}
+
+TEST(SetAssocTlb, LookupWithoutLRUUpdate)
+{
+    TestLRU lru;
+    TestTlb tlb(2, 2, &lru);
+    tlb.insert(0x0000, makeEntry(0x10000));
+    tlb.insert(0x1000, makeEntry(0x20000));
+
+    // A hidden lookup doesn't protect 0x0000 from eviction
+    ASSERT_NE(nullptr, tlb.lookup(0x0000, false));
+    tlb.insert(0x2000, makeEntry(0x30000));
+    ASSERT_EQ(nullptr, tlb.lookup(0x0000));
+    ASSERT_NE(nullptr, tlb.lookup(0x1000));
+}
+
+TEST(SetAssocTlb, Remove)
+{
+    TestLRU lru;
+    TestTlb tlb(16, 4, &lru);
+    tlb.insert(0x1000, makeEntry(0x8000));
+    tlb.insert(0x200000, makeEntry(0x40000000, 21));
+
+    tlb.remove(tlb.lookup(0x1000));
+    ASSERT_EQ(nullptr, tlb.lookup(0x1000));
+    ASSERT_EQ(1, tlb.occupancy());
+
+    tlb.removeIf([](const TestEntry &entry) { return entry.logBytes == 21; });
+    ASSERT_EQ(nullptr, tlb.lookup(0x200000));
+    ASSERT_EQ(0, tlb.occupancy());
+}
+
+TEST(SetAssocTlb, FlushAll)
+{
+    TestLRU lru;
+    TestTlb tlb(8, 8, &lru);
+    for (Addr page = 0; page < 8; page++)
+        tlb.insert(page << 12, makeEntry(page << 16));
+    ASSERT_EQ(8, tlb.occupancy());
+
+    unsigned count = 0;
+    tlb.forEach([&count](const TestEntry &) { count++; });
+    ASSERT_EQ(8, count);
+
+    tlb.flushAll();
+    ASSERT_EQ(0, tlb.occupancy());
+    for (Addr page = 0; page < 8; page++)
+        ASSERT_EQ(nullptr, tlb.lookup(page << 12));
+}
+
+TEST(SetAssocTlb, BadGeometry)
+{
+    TestLRU lru;
+    ASSERT_ANY_THROW(TestTlb(16, 3, &lru));
+    ASSERT_ANY_THROW(TestTlb(24, 4, &lru));
+    ASSERT_ANY_THROW(TestTlb(16, 4, nullptr));
+}
+
+TEST(SetAssocTlb, Restore)
+{
+    TestLRU lru;
+    TestTlb tlb(2, 2, &lru);
+    tlb.insert(0x0000, makeEntry(0x10000));
+    tlb.insert(0x1000, makeEntry(0x20000));
+    ASSERT_NE(nullptr, tlb.lookup(0x0000));
+
+    // Save the entries in placement order, 0x0000 first, as a checkpoint
+    std::vector<std::pair<Addr, TestEntry>> saved;
+    tlb.forEach([&](const TestEntry &entry) {
+        saved.emplace_back(tlb.key(&entry), entry);
+    });
+
+    TestLRU restored_lru;
+    TestTlb restored(2, 2, &restored_lru);
+    restored.restore(saved, tlb.lastSeq());
+    ASSERT_EQ(2, restored.occupancy());
+    ASSERT_EQ(tlb.lastSeq(), restored.lastSeq());
+
+    // 0x1000 is still the least recently used entry
+    restored.insert(0x2000, makeEntry(0x30000));
+    ASSERT_NE(nullptr, restored.lookup(0x0000, false));
+    ASSERT_EQ(nullptr, restored.lookup(0x1000, false));
+    ASSERT_EQ(tlb.lastSeq() + 1, restored.lookup(0x2000, false)->lruSeq);
+}
@@ -219,6 +219,22 @@ class VecPredRegT
         }
         return false;
     }
+
+    /// Returns true if all the elements of the register are true, which
+    /// lets predicated operations use the same code as unpredicated ones.
+    /// @param actual_num_elems Actual number of vector elements considered for
+    /// the test (corresponding to the current vector length).
+    bool
+    allActive(size_t actual_num_elems) const
+    {
+        assert(actual_num_elems <= NumElems);
+        for (int i = 0; i < actual_num_elems; ++i) {
+            if (!operator[](i)) {
+                return false;
+            }
+        }
+        return true;
+    }
 };
 
 /// Generic predicate register container.
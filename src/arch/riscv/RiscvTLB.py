@@ -30,6 +30,7 @@
 
 from m5.objects.BaseTLB import BaseTLB
 from m5.objects.ClockedObject import ClockedObject
+from m5.objects.ReplacementPolicies import *
 from m5.params import *
 from m5.proxy import *
 
@@ -55,8 +56,19 @@ class RiscvTLB(BaseTLB):
     cxx_header = "arch/riscv/tlb.hh"
 
     size = Param.Int(64, "TLB size")
+    assoc = Param.Int(
+        Self.size,
+        "TLB associativity; entries are indexed by virtual page number "
+        "(one set per page size), and a value equal to size makes the "
+        "TLB fully associative",
+    )
+    replacement_policy = Param.BaseReplacementPolicy(
+        ListLRURP(), "Replacement policy within a set"
+    )
     walker = Param.RiscvPagetableWalker(
-        RiscvPagetableWalker(), "page table walker"
+        RiscvPagetableWalker(),
+        "page table walker (only needed by the first level TLBs, set it to "
+        "NULL for the TLBs only used as next_level of other TLBs)",
     )
     # Grab the pma_checker from the MMU
     pma_checker = Param.PMAChecker(Parent.any, "PMA Checker")
@@ -28,6 +28,9 @@
  */
 
 #include "arch/riscv/decoder.hh"
+
+#include <utility>
+
 #include "arch/riscv/isa.hh"
 #include "arch/riscv/types.hh"
 #include "base/bitfield.hh"
@@ -44,6 +47,9 @@ Decoder::Decoder(const RiscvDecoderParams &p) : InstDecoder(p, &machInst)
     ISA *isa = dynamic_cast<ISA*>(p.isa);
     vlen = isa->getVecLenInBits();
     elen = isa->getVecElemLenInBits();
+    instMap = &decode_cache::shared<
+        decode_cache::SharedInstMap<ExtMachInst>, Decoder>(
+                std::make_pair(vlen, elen));
     reset();
 }
 
@@ -95,11 +101,12 @@ Decoder::decode(ExtMachInst mach_inst, Addr addr)
     DPRINTF(Decode, "Decoding instruction 0x%08x at address %#x\n",
             mach_inst.instBits, addr);
 
-    StaticInstPtr &si = instMap[mach_inst];
-    if (!si)
+    StaticInstPtr si = instMap->find(mach_inst);
+    if (!si) {
         si = decodeInst(mach_inst);
-
-    si->size(compressed(mach_inst) ? 2 : 4);
+        si->size(compressed(mach_inst) ? 2 : 4);
+        si = instMap->insert(mach_inst, si);
+    }
 
     DPRINTF(Decode, "Decode: Decoded %s instruction: %#x\n",
             si->getName(), mach_inst);
@@ -51,7 +51,9 @@ namespace RiscvISA
 class Decoder : public InstDecoder
 {
   private:
-    decode_cache::InstMap<ExtMachInst> instMap;
+    /// Decoded instructions, shared with the decoders which have the
+    /// same vector configuration.
+    decode_cache::SharedInstMap<ExtMachInst> *instMap;
     bool aligned;
     bool mid;
 
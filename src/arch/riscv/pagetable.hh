@@ -33,7 +33,6 @@
 
 #include "base/bitunion.hh"
 #include "base/logging.hh"
-#include "base/trie.hh"
 #include "base/types.hh"
 #include "sim/serialize.hh"
 
@@ -76,9 +75,6 @@ BitUnion64(PTESv39)
     Bitfield<0> v;
 EndBitUnion(PTESv39)
 
-struct TlbEntry;
-typedef Trie<Addr, TlbEntry> TlbEntryTrie;
-
 struct TlbEntry : public Serializable
 {
     // The base of the physical page.
@@ -93,8 +89,6 @@ struct TlbEntry : public Serializable
 
     PTESv39 pte;
 
-    TlbEntryTrie::Handle trieHandle;
-
     // A sequence number to keep track of LRU.
     uint64_t lruSeq;
 
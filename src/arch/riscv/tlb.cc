@@ -32,6 +32,7 @@
 #include "arch/riscv/tlb.hh"
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "arch/riscv/faults.hh"
@@ -71,17 +72,14 @@ buildKey(Addr vpn, uint16_t asid)
 }
 
 TLB::TLB(const Params &p) :
-    BaseTLB(p), size(p.size), tlb(size),
-    lruSeq(0), stats(this), pma(p.pma_checker),
+    BaseTLB(p), size(p.size), tlb(size, p.assoc, p.replacement_policy),
+    stats(this), pma(p.pma_checker),
     pmp(p.pmp)
 {
-    for (size_t x = 0; x < size; x++) {
-        tlb[x].trieHandle = NULL;
-        freeList.push_back(&tlb[x]);
-    }
-
+    // Only the first level TLBs of the hierarchy need a walker
     walker = p.walker;
-    walker->setTLB(this);
+    if (walker)
+        walker->setTLB(this);
 }
 
 Walker *
@@ -90,30 +88,12 @@ TLB::getWalker()
     return walker;
 }
 
-void
-TLB::evictLRU()
-{
-    // Find the entry with the lowest (and hence least recently updated)
-    // sequence number.
-
-    size_t lru = 0;
-    for (size_t i = 1; i < size; i++) {
-        if (tlb[i].lruSeq < tlb[lru].lruSeq)
-            lru = i;
-    }
-
-    remove(lru);
-}
-
 TlbEntry *
 TLB::lookup(Addr vpn, uint16_t asid, BaseMMU::Mode mode, bool hidden)
 {
-    TlbEntry *entry = trie.lookup(buildKey(vpn, asid));
+    TlbEntry *entry = tlb.lookup(buildKey(vpn, asid), !hidden);
 
     if (!hidden) {
-        if (entry)
-            entry->lruSeq = nextSeq();
-
         if (mode == BaseMMU::Write)
             stats.writeAccesses++;
         else
@@ -136,17 +116,25 @@ TLB::lookup(Addr vpn, uint16_t asid, BaseMMU::Mode mode, bool hidden)
                 vpn, asid, entry ? "hit" : "miss", entry ? entry->paddr : 0);
     }
 
+    if (!entry && nextLevelTlb()) {
+        entry = nextLevelTlb()->lookup(vpn, asid, mode, hidden);
+        if (entry && !hidden) {
+            DPRINTF(TLB, "fill(vpn=%#x, asid=%#x) from the next level\n",
+                    vpn, asid);
+            entry = insertLocal(entry->vaddr, *entry);
+        }
+    }
+
     return entry;
 }
 
 TlbEntry *
-TLB::insert(Addr vpn, const TlbEntry &entry)
+TLB::insertLocal(Addr vpn, const TlbEntry &entry)
 {
-    DPRINTF(TLB, "insert(vpn=%#x, asid=%#x): ppn=%#x pte=%#x size=%#x\n",
-        vpn, entry.asid, entry.paddr, entry.pte, entry.size());
+    Addr key = buildKey(vpn, entry.asid);
 
     // If somebody beat us to it, just use that existing entry.
-    TlbEntry *newEntry = lookup(vpn, entry.asid, BaseMMU::Read, true);
+    TlbEntry *newEntry = tlb.lookup(key, false);
     if (newEntry) {
         // update PTE flags (maybe we set the dirty/writable flag)
         newEntry->pte = entry.pte;
@@ -154,21 +142,23 @@ TLB::insert(Addr vpn, const TlbEntry &entry)
         return newEntry;
     }
 
-    if (freeList.empty())
-        evictLRU();
-
-    newEntry = freeList.front();
-    freeList.pop_front();
-
-    Addr key = buildKey(vpn, entry.asid);
-    *newEntry = entry;
-    newEntry->lruSeq = nextSeq();
+    newEntry = tlb.insert(key, entry);
     newEntry->vaddr = vpn;
-    newEntry->trieHandle =
-    trie.insert(key, TlbEntryTrie::MaxBits - entry.logBytes, newEntry);
     return newEntry;
 }
 
+TlbEntry *
+TLB::insert(Addr vpn, const TlbEntry &entry)
+{
+    DPRINTF(TLB, "insert(vpn=%#x, asid=%#x): ppn=%#x pte=%#x size=%#x\n",
+        vpn, entry.asid, entry.paddr, entry.pte, entry.size());
+
+    for (TLB *next = nextLevelTlb(); next; next = next->nextLevelTlb())
+        next->insertLocal(vpn, entry);
+
+    return insertLocal(vpn, entry);
+}
+
 void
 TLB::demapPage(Addr vpn, uint64_t asid)
 {
@@ -179,44 +169,47 @@ TLB::demapPage(Addr vpn, uint64_t asid)
     else {
         DPRINTF(TLB, "flush(vpn=%#x, asid=%#x)\n", vpn, asid);
         if (vpn != 0 && asid != 0) {
-            TlbEntry *newEntry = lookup(vpn, asid, BaseMMU::Read, true);
+            TlbEntry *newEntry = tlb.lookup(buildKey(vpn, asid), false);
             if (newEntry)
-                remove(newEntry - tlb.data());
+                remove(newEntry);
         }
         else {
-            for (size_t i = 0; i < size; i++) {
-                if (tlb[i].trieHandle) {
-                    Addr mask = ~(tlb[i].size() - 1);
-                    if ((vpn == 0 || (vpn & mask) == tlb[i].vaddr) &&
-                        (asid == 0 || tlb[i].asid == asid))
-                        remove(i);
+            tlb.removeIf([&](const TlbEntry &entry) {
+                Addr mask = ~(entry.size() - 1);
+                if ((vpn == 0 || (vpn & mask) == entry.vaddr) &&
+                    (asid == 0 || entry.asid == asid)) {
+                    traceRemove(entry);
+                    return true;
                 }
-            }
+                return false;
+            });
         }
     }
+
+    // The next levels are inclusive, they might hold the page as well
+    if (nextLevelTlb())
+        nextLevelTlb()->demapPage(vpn, asid);
 }
 
 void
 TLB::flushAll()
 {
     DPRINTF(TLB, "flushAll()\n");
-    for (size_t i = 0; i < size; i++) {
-        if (tlb[i].trieHandle)
-            remove(i);
-    }
+    tlb.flushAll();
 }
 
 void
-TLB::remove(size_t idx)
+TLB::traceRemove(const TlbEntry &entry) const
 {
     DPRINTF(TLB, "remove(vpn=%#x, asid=%#x): ppn=%#x pte=%#x size=%#x\n",
-        tlb[idx].vaddr, tlb[idx].asid, tlb[idx].paddr, tlb[idx].pte,
-        tlb[idx].size());
+        entry.vaddr, entry.asid, entry.paddr, entry.pte, entry.size());
+}
 
-    assert(tlb[idx].trieHandle);
-    trie.remove(tlb[idx].trieHandle);
-    tlb[idx].trieHandle = NULL;
-    freeList.push_back(&tlb[idx]);
+void
+TLB::remove(TlbEntry *entry)
+{
+    traceRemove(*entry);
+    tlb.remove(entry);
 }
 
 Fault
@@ -454,7 +447,7 @@ TLB::translateFunctional(const RequestPtr &req, ThreadContext *tc,
     }
     else {
         Process *process = tc->getProcessPtr();
-        const auto *pte = process->pTable->lookup(vaddr);
+        auto pte = process->pTable->lookup(vaddr);
 
         if (!pte && mode != BaseMMU::Execute) {
             // Check if we just need to grow the stack.
@@ -486,15 +479,15 @@ void
 TLB::serialize(CheckpointOut &cp) const
 {
     // Only store the entries in use.
-    uint32_t _size = size - freeList.size();
+    uint32_t _size = tlb.occupancy();
     SERIALIZE_SCALAR(_size);
+    uint64_t lruSeq = tlb.lastSeq();
     SERIALIZE_SCALAR(lruSeq);
 
     uint32_t _count = 0;
-    for (uint32_t x = 0; x < size; x++) {
-        if (tlb[x].trieHandle != NULL)
-            tlb[x].serializeSection(cp, csprintf("Entry%d", _count++));
-    }
+    tlb.forEach([&](const TlbEntry &entry) {
+        entry.serializeSection(cp, csprintf("Entry%d", _count++));
+    });
 }
 
 void
@@ -507,17 +500,18 @@ TLB::unserialize(CheckpointIn &cp)
         fatal("TLB size less than the one in checkpoint!");
     }
 
+    uint64_t lruSeq;
     UNSERIALIZE_SCALAR(lruSeq);
 
+    // Keep the saved lruSeq of the entries, so that the replacement
+    // order is the same as when the checkpoint was taken.
+    std::vector<std::pair<Addr, TlbEntry>> saved;
     for (uint32_t x = 0; x < _size; x++) {
-        TlbEntry *newEntry = freeList.front();
-        freeList.pop_front();
-
-        newEntry->unserializeSection(cp, csprintf("Entry%d", x));
-        Addr key = buildKey(newEntry->vaddr, newEntry->asid);
-        newEntry->trieHandle = trie.insert(key,
-            TlbEntryTrie::MaxBits - newEntry->logBytes, newEntry);
+        TlbEntry newEntry;
+        newEntry.unserializeSection(cp, csprintf("Entry%d", x));
+        saved.emplace_back(buildKey(newEntry.vaddr, newEntry.asid), newEntry);
     }
+    tlb.restore(std::move(saved), lruSeq);
 }
 
 TLB::TlbStats::TlbStats(statistics::Group *parent)
@@ -541,7 +535,7 @@ TLB::TlbStats::TlbStats(statistics::Group *parent)
 Port *
 TLB::getTableWalkerPort()
 {
-    return &walker->getPort("port");
+    return walker ? &walker->getPort("port") : nullptr;
 }
 
 } // namespace gem5
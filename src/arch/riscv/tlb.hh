@@ -32,8 +32,7 @@
 #ifndef __ARCH_RISCV_TLB_HH__
 #define __ARCH_RISCV_TLB_HH__
 
-#include <list>
-
+#include "arch/generic/set_assoc_tlb.hh"
 #include "arch/generic/tlb.hh"
 #include "arch/riscv/isa.hh"
 #include "arch/riscv/pagetable.hh"
@@ -41,6 +40,7 @@
 #include "arch/riscv/regs/misc.hh"
 #include "arch/riscv/utility.hh"
 #include "base/statistics.hh"
+#include "mem/cache/replacement_policies/base.hh"
 #include "mem/request.hh"
 #include "params/RiscvTLB.hh"
 #include "sim/sim_object.hh"
@@ -58,14 +58,9 @@ class Walker;
 
 class TLB : public BaseTLB
 {
-    typedef std::list<TlbEntry *> EntryList;
-
   protected:
     size_t size;
-    std::vector<TlbEntry> tlb;  // our TLB
-    TlbEntryTrie trie;          // for quick access
-    EntryList freeList;         // free entries
-    uint64_t lruSeq;
+    SetAssocTlb<TlbEntry> tlb;  // our TLB
 
     Walker *walker;
 
@@ -97,6 +92,10 @@ class TLB : public BaseTLB
 
     void takeOverFrom(BaseTLB *old) override {}
 
+    /**
+     * Insert an entry in this TLB and in the next levels of the
+     * hierarchy (which are thus inclusive).
+     */
     TlbEntry *insert(Addr vpn, const TlbEntry &entry);
     void flushAll() override;
     void demapPage(Addr vaddr, uint64_t asn) override;
@@ -136,12 +135,21 @@ class TLB : public BaseTLB
                            BaseMMU::Mode mode) const override;
 
   private:
-    uint64_t nextSeq() { return ++lruSeq; }
+    /** The next level TLB, if any */
+    TLB *nextLevelTlb() const { return static_cast<TLB *>(nextLevel()); }
 
+    /**
+     * Look an entry up in this TLB and, on a miss, in the next levels
+     * of the hierarchy. Entries found in a next level are copied into
+     * this one unless the lookup is hidden.
+     */
     TlbEntry *lookup(Addr vpn, uint16_t asid, BaseMMU::Mode mode, bool hidden);
 
-    void evictLRU();
-    void remove(size_t idx);
+    /** Insert an entry in this TLB only */
+    TlbEntry *insertLocal(Addr vpn, const TlbEntry &entry);
+
+    void remove(TlbEntry *entry);
+    void traceRemove(const TlbEntry &entry) const;
 
     Fault translate(const RequestPtr &req, ThreadContext *tc,
                     BaseMMU::Translation *translation, BaseMMU::Mode mode,
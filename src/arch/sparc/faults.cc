@@ -626,7 +626,7 @@ FastInstructionAccessMMUMiss::invoke(ThreadContext *tc,
     }
 
     Process *p = tc->getProcessPtr();
-    const EmulationPageTable::Entry *pte = p->pTable->lookup(vaddr);
+    auto pte = p->pTable->lookup(vaddr);
     panic_if(!pte, "Tried to execute unmapped address %#x.\n", vaddr);
 
     Addr alignedvaddr = p->pTable->pageAlign(vaddr);
@@ -682,7 +682,7 @@ FastDataAccessMMUMiss::invoke(ThreadContext *tc, const StaticInstPtr &inst)
     }
 
     Process *p = tc->getProcessPtr();
-    const EmulationPageTable::Entry *pte = p->pTable->lookup(vaddr);
+    auto pte = p->pTable->lookup(vaddr);
     if (!pte && p->fixupFault(vaddr))
         pte = p->pTable->lookup(vaddr);
     panic_if(!pte, "Tried to access unmapped address %#x.\n", vaddr);
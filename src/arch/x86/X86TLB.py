@@ -35,6 +35,7 @@
 
 from m5.objects.BaseTLB import BaseTLB
 from m5.objects.ClockedObject import ClockedObject
+from m5.objects.ReplacementPolicies import *
 from m5.params import *
 from m5.proxy import *
 
@@ -57,7 +58,18 @@ class X86TLB(BaseTLB):
     cxx_header = "arch/x86/tlb.hh"
 
     size = Param.Unsigned(64, "TLB size")
+    assoc = Param.Unsigned(
+        Self.size,
+        "TLB associativity; entries are indexed by virtual page number "
+        "(one set per page size), and a value equal to size makes the "
+        "TLB fully associative",
+    )
+    replacement_policy = Param.BaseReplacementPolicy(
+        ListLRURP(), "Replacement policy within a set"
+    )
     system = Param.System(Parent.any, "system object")
     walker = Param.X86PagetableWalker(
-        X86PagetableWalker(), "page table walker"
+        X86PagetableWalker(),
+        "page table walker (only needed by the first level TLBs, set it to "
+        "NULL for the TLBs only used as next_level of other TLBs)",
     )
@@ -70,7 +70,7 @@ Decoder::doResetState()
         return FromCacheState;
     } else {
         instBytes->chunks.clear();
-        return PrefixState;
+        return FromByteCacheState;
     }
 }
 
@@ -92,6 +92,8 @@ Decoder::process()
     } else {
         instBytes->chunks.push_back(fetchChunk);
     }
+    if (state == FromByteCacheState)
+        state = doFromByteCacheState();
 
     // While there's still something to do...
     while (!instDone && !outOfBytes) {
@@ -163,6 +165,7 @@ Decoder::doFromCacheState()
         return PrefixState;
     } else if (chunkIdx == instBytes->chunks.size() - 1) {
         // We matched the cache, so use its value.
+        stats.addrCacheHits++;
         instDone = true;
         offset = instBytes->lastOffset;
         if (offset == sizeof(MachInst))
@@ -176,6 +179,57 @@ Decoder::doFromCacheState()
     }
 }
 
+Decoder::State
+Decoder::doFromByteCacheState()
+{
+    if (!byteCache)
+        return PrefixState;
+
+    // Only the lengths of the instructions cached with the same first
+    // byte which fit in what's left of the chunk need to be checked. As
+    // no instruction is a prefix of another one, at most one matches.
+    const MachInst bytes = fetchChunk >> (offset * 8);
+    const int remaining = sizeof(MachInst) - offset;
+    uint16_t lengths = byteCache->lengths[bytes & mask(8)].load(
+            std::memory_order_relaxed) & mask(remaining + 1);
+
+    for (; lengths; lengths &= lengths - 1) {
+        const int size = findLsbSet(lengths);
+        StaticInstPtr si = byteCache->insts.find(
+                {bytes & mask(size * 8), (uint8_t)size});
+        if (!si)
+            continue;
+
+        DPRINTF(Decoder, "Decode byte cache hit, size %d.\n", size);
+        stats.byteCacheHits++;
+
+        // Fill the address cache entry in as if the instruction had been
+        // decoded by the state machine.
+        const MachInst inst_mask = mask(size * 8) << (offset * 8);
+        instBytes->chunks.assign(1, fetchChunk & inst_mask);
+        instBytes->masks.assign(1, inst_mask);
+        instBytes->si = si;
+
+        consumeBytes(size);
+        instBytes->lastOffset = offset;
+        instDone = true;
+        return ResetState;
+    }
+    return PrefixState;
+}
+
+void
+Decoder::insertByteCache(MachInst chunk, int start, int size,
+                         const StaticInstPtr &si)
+{
+    assert(size > 0 && start + size <= sizeof(MachInst));
+
+    const MachInst bytes = (chunk >> (start * 8)) & mask(size * 8);
+    byteCache->insts.insert({bytes, (uint8_t)size}, si);
+    byteCache->lengths[bytes & mask(8)].fetch_or(
+            1 << size, std::memory_order_relaxed);
+}
+
 // Either get a prefix and record it in the ExtMachInst, or send the
 // state machine on to get the opcode(s).
 Decoder::State
@@ -672,23 +726,19 @@ Decoder::doImmediateState()
 }
 
 Decoder::InstBytes Decoder::dummy;
-Decoder::InstCacheMap Decoder::instCacheMap;
 
 StaticInstPtr
 Decoder::decode(ExtMachInst mach_inst, Addr addr)
 {
-    StaticInstPtr si;
+    const InstKey key{mach_inst, (uint8_t)(basePC + offset - origPC)};
 
-    auto iter = instMap->find(mach_inst);
-    if (iter != instMap->end()) {
-        si = iter->second;
-    } else {
+    StaticInstPtr si = instMap->find(key);
+    if (!si) {
         si = decodeInst(mach_inst);
-        (*instMap)[mach_inst] = si;
+        si->size(key.size);
+        si = instMap->insert(key, si);
     }
 
-    si->size(basePC + offset - origPC);
-
     DPRINTF(Decode, "Decode: Decoded %s instruction: %#x\n",
             si->getName(), mach_inst);
     return si;
@@ -734,7 +784,26 @@ Decoder::decode(PCStateBase &next_pc)
         start = 0;
     }
 
-    return decode(emi, origPC);
+    stats.fullDecodes++;
+    si = decode(emi, origPC);
+
+    if (byteCache && instBytes->chunks.size() == 1) {
+        insertByteCache(instBytes->chunks[0], firstOffset,
+                        instBytes->lastOffset - firstOffset, si);
+    }
+
+    return si;
+}
+
+Decoder::DecoderStats::DecoderStats(statistics::Group *parent)
+    : statistics::Group(parent),
+      ADD_STAT(addrCacheHits, statistics::units::Count::get(),
+               "Instructions found in the decode cache by address"),
+      ADD_STAT(byteCacheHits, statistics::units::Count::get(),
+               "Instructions found in the decode cache by bytes"),
+      ADD_STAT(fullDecodes, statistics::units::Count::get(),
+               "Instructions decoded by the decoder state machine")
+{
 }
 
 StaticInstPtr
@@ -29,6 +29,8 @@
 #ifndef __ARCH_X86_DECODER_HH__
 #define __ARCH_X86_DECODER_HH__
 
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <unordered_map>
 #include <vector>
@@ -45,6 +47,7 @@
 #include "cpu/static_inst.hh"
 #include "debug/Decoder.hh"
 #include "params/X86Decoder.hh"
+#include "sim/stats.hh"
 
 namespace gem5
 {
@@ -189,6 +192,7 @@ class Decoder : public InstDecoder
     {
         ResetState,
         FromCacheState,
+        FromByteCacheState,
         PrefixState,
         Vex2Of2State,
         Vex2Of3State,
@@ -211,6 +215,7 @@ class Decoder : public InstDecoder
     // Functions to handle each of the states
     State doResetState();
     State doFromCacheState();
+    State doFromByteCacheState();
     State doPrefixState(uint8_t);
     State doVex2Of2State(uint8_t);
     State doVex2Of3State(uint8_t);
@@ -241,10 +246,91 @@ class Decoder : public InstDecoder
     typedef std::unordered_map<CacheKey, DecodePages *> AddrCacheMap;
     AddrCacheMap addrCacheMap;
 
-    decode_cache::InstMap<ExtMachInst> *instMap = nullptr;
-    typedef std::unordered_map<
-            CacheKey, decode_cache::InstMap<ExtMachInst> *> InstCacheMap;
-    static InstCacheMap instCacheMap;
+    /// Key of the decoded instructions. The same instruction may be
+    /// encoded with redundant prefixes, so its length is part of the key:
+    /// this way, the size of the shared StaticInst objects is set once,
+    /// before they are published, and never written to afterwards.
+    struct InstKey
+    {
+        ExtMachInst machInst;
+        uint8_t size;
+
+        bool
+        operator==(const InstKey &other) const
+        {
+            return machInst == other.machInst && size == other.size;
+        }
+    };
+
+    struct InstKeyHash
+    {
+        size_t
+        operator()(const InstKey &key) const
+        {
+            return std::hash<ExtMachInst>()(key.machInst) ^ key.size;
+        }
+    };
+
+    typedef decode_cache::SharedInstMap<InstKey, InstKeyHash> InstMap;
+
+    /// Decoded instructions, shared with the decoders of the other CPUs
+    /// which are in the same mode.
+    InstMap *instMap = nullptr;
+
+    /// Caching of decoded instruction objects by raw instruction bytes,
+    /// which lets instructions decoded at a new address skip the state
+    /// machine if the same bytes have been decoded (in the same mode)
+    /// before. Only the instructions fully contained in a fetch chunk
+    /// are cached. Like instMap, it is shared by all the decoders.
+    struct ByteCache
+    {
+        struct Key
+        {
+            MachInst bytes;
+            uint8_t size;
+
+            bool
+            operator==(const Key &other) const
+            {
+                return bytes == other.bytes && size == other.size;
+            }
+        };
+
+        struct KeyHash
+        {
+            size_t
+            operator()(const Key &key) const
+            {
+                return std::hash<MachInst>()(key.bytes) ^ key.size;
+            }
+        };
+
+        ByteCache()
+        {
+            for (auto &length: lengths)
+                length.store(0, std::memory_order_relaxed);
+        }
+
+        /// Bitmask of the lengths of the cached instructions, indexed
+        /// by their first byte.
+        std::array<std::atomic<uint16_t>, 256> lengths;
+        /// Cached instructions, indexed by length and bytes.
+        decode_cache::SharedInstMap<Key, KeyHash> insts{14};
+    };
+
+    ByteCache *byteCache = nullptr;
+
+    void insertByteCache(MachInst chunk, int start, int size,
+                         const StaticInstPtr &si);
+
+    struct DecoderStats : public statistics::Group
+    {
+        DecoderStats(statistics::Group *parent);
+
+        statistics::Scalar addrCacheHits;
+        statistics::Scalar byteCacheHits;
+        statistics::Scalar fullDecodes;
+    } stats;
 
     StaticInstPtr decodeInst(ExtMachInst mach_inst);
 
@@ -256,7 +342,8 @@ class Decoder : public InstDecoder
     void process();
 
   public:
-    Decoder(const X86DecoderParams &p) : InstDecoder(p, &fetchChunk)
+    Decoder(const X86DecoderParams &p) :
+        InstDecoder(p, &fetchChunk), stats(this)
     {
         emi.reset();
         emi.mode.cpl = cpl;
@@ -287,13 +374,10 @@ class Decoder : public InstDecoder
             addrCacheMap[m5Reg] = decodePages;
         }
 
-        InstCacheMap::iterator imIter = instCacheMap.find(m5Reg);
-        if (imIter != instCacheMap.end()) {
-            instMap = imIter->second;
-        } else {
-            instMap = new decode_cache::InstMap<ExtMachInst>;
-            instCacheMap[m5Reg] = instMap;
-        }
+        instMap = &decode_cache::shared<InstMap, Decoder>(
+                (CacheKey)m5Reg);
+        byteCache = &decode_cache::shared<ByteCache, Decoder>(
+                (CacheKey)m5Reg);
     }
 
     void
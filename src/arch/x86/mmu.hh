@@ -59,8 +59,12 @@ class MMU : public BaseMMU
     void
     flushNonGlobal()
     {
-        static_cast<TLB*>(itb)->flushNonGlobal();
-        static_cast<TLB*>(dtb)->flushNonGlobal();
+        for (auto tlb : instruction)
+            static_cast<TLB*>(tlb)->flushNonGlobal();
+        for (auto tlb : data)
+            static_cast<TLB*>(tlb)->flushNonGlobal();
+        for (auto tlb : unified)
+            static_cast<TLB*>(tlb)->flushNonGlobal();
     }
 
     Walker*
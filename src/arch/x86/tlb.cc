@@ -39,6 +39,8 @@
 
 #include <cstring>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "arch/x86/faults.hh"
 #include "arch/x86/insts/microldstop.hh"
@@ -64,36 +66,28 @@ namespace X86ISA {
 
 TLB::TLB(const Params &p)
     : BaseTLB(p), configAddress(0), size(p.size),
-      tlb(size), lruSeq(0), m5opRange(p.system->m5opRange()), stats(this)
+      tlb(size, p.assoc, p.replacement_policy),
+      m5opRange(p.system->m5opRange()), stats(this)
 {
-    if (!size)
-        fatal("TLBs must have a non-zero size.\n");
-
-    for (int x = 0; x < size; x++) {
-        tlb[x].trieHandle = NULL;
-        freeList.push_back(&tlb[x]);
-    }
-
+    // Only the first level TLBs of the hierarchy need a walker
     walker = p.walker;
-    walker->setTLB(this);
+    if (walker)
+        walker->setTLB(this);
 }
 
-void
-TLB::evictLRU()
+TlbEntry *
+TLB::insertLocal(Addr vpn, const TlbEntry &entry)
 {
-    // Find the entry with the lowest (and hence least recently updated)
-    // sequence number.
-
-    unsigned lru = 0;
-    for (unsigned i = 1; i < size; i++) {
-        if (tlb[i].lruSeq < tlb[lru].lruSeq)
-            lru = i;
+    // If somebody beat us to it, just use that existing entry.
+    TlbEntry *newEntry = tlb.lookup(vpn, false);
+    if (newEntry) {
+        assert(newEntry->vaddr == vpn);
+        return newEntry;
     }
 
-    assert(tlb[lru].trieHandle);
-    trie.remove(tlb[lru].trieHandle);
-    tlb[lru].trieHandle = NULL;
-    freeList.push_back(&tlb[lru]);
+    newEntry = tlb.insert(vpn, entry);
+    newEntry->vaddr = vpn;
+    return newEntry;
 }
 
 TlbEntry *
@@ -105,39 +99,29 @@ TLB::insert(Addr vpn, const TlbEntry &entry, uint64_t pcid)
     //virtual addresses
     vpn = concAddrPcid(vpn, pcid);
 
-    // If somebody beat us to it, just use that existing entry.
-    TlbEntry *newEntry = trie.lookup(vpn);
-    if (newEntry) {
-        assert(newEntry->vaddr == vpn);
-        return newEntry;
-    }
-
-    if (freeList.empty())
-        evictLRU();
+    for (TLB *next = nextLevelTlb(); next; next = next->nextLevelTlb())
+        next->insertLocal(vpn, entry);
 
-    newEntry = freeList.front();
-    freeList.pop_front();
-
-    *newEntry = entry;
-    newEntry->lruSeq = nextSeq();
-    newEntry->vaddr = vpn;
-    if (FullSystem) {
-        newEntry->trieHandle =
-        trie.insert(vpn, TlbEntryTrie::MaxBits-entry.logBytes, newEntry);
-    }
-    else {
-        newEntry->trieHandle =
-        trie.insert(vpn, TlbEntryTrie::MaxBits, newEntry);
-    }
-    return newEntry;
+    return insertLocal(vpn, entry);
 }
 
 TlbEntry *
 TLB::lookup(Addr va, bool update_lru)
 {
-    TlbEntry *entry = trie.lookup(va);
-    if (entry && update_lru)
-        entry->lruSeq = nextSeq();
+    TlbEntry *entry = tlb.lookup(va, update_lru);
+    if (update_lru) {
+        stats.lookups++;
+        if (!entry)
+            stats.lookupMisses++;
+    }
+
+    if (!entry && nextLevelTlb()) {
+        entry = nextLevelTlb()->lookup(va, update_lru);
+        if (entry && update_lru) {
+            DPRINTF(TLB, "Filling %#x from the next level TLB.\n", va);
+            entry = insertLocal(entry->vaddr, *entry);
+        }
+    }
     return entry;
 }
 
@@ -145,13 +129,7 @@ void
 TLB::flushAll()
 {
     DPRINTF(TLB, "Invalidating all entries.\n");
-    for (unsigned i = 0; i < size; i++) {
-        if (tlb[i].trieHandle) {
-            trie.remove(tlb[i].trieHandle);
-            tlb[i].trieHandle = NULL;
-            freeList.push_back(&tlb[i]);
-        }
-    }
+    tlb.flushAll();
 }
 
 void
@@ -164,24 +142,19 @@ void
 TLB::flushNonGlobal()
 {
     DPRINTF(TLB, "Invalidating all non global entries.\n");
-    for (unsigned i = 0; i < size; i++) {
-        if (tlb[i].trieHandle && !tlb[i].global) {
-            trie.remove(tlb[i].trieHandle);
-            tlb[i].trieHandle = NULL;
-            freeList.push_back(&tlb[i]);
-        }
-    }
+    tlb.removeIf([](const TlbEntry &entry) { return !entry.global; });
 }
 
 void
 TLB::demapPage(Addr va, uint64_t asn)
 {
-    TlbEntry *entry = trie.lookup(va);
-    if (entry) {
-        trie.remove(entry->trieHandle);
-        entry->trieHandle = NULL;
-        freeList.push_back(entry);
-    }
+    TlbEntry *entry = tlb.lookup(va, false);
+    if (entry)
+        tlb.remove(entry);
+
+    // The next levels are inclusive, they might hold the page as well
+    if (nextLevelTlb())
+        nextLevelTlb()->demapPage(va, asn);
 }
 
 namespace
@@ -443,8 +416,7 @@ TLB::translate(const RequestPtr &req,
                     assert(entry);
                 } else {
                     Process *p = tc->getProcessPtr();
-                    const EmulationPageTable::Entry *pte =
-                        p->pTable->lookup(vaddr);
+                    auto pte = p->pTable->lookup(vaddr);
                     if (!pte) {
                         return std::make_shared<PageFault>(vaddr, true, mode,
                                                            true, false);
@@ -533,7 +505,7 @@ TLB::translateFunctional(const RequestPtr &req, ThreadContext *tc,
         paddr = insertBits(addr, logBytes - 1, 0, vaddr);
     } else {
         Process *process = tc->getProcessPtr();
-        const auto *pte = process->pTable->lookup(vaddr);
+        auto pte = process->pTable->lookup(vaddr);
 
         if (!pte && mode != BaseMMU::Execute) {
             // Check if we just need to grow the stack.
@@ -585,7 +557,11 @@ TLB::TlbStats::TlbStats(statistics::Group *parent)
     ADD_STAT(rdMisses, statistics::units::Count::get(),
              "TLB misses on read requests"),
     ADD_STAT(wrMisses, statistics::units::Count::get(),
-             "TLB misses on write requests")
+             "TLB misses on write requests"),
+    ADD_STAT(lookups, statistics::units::Count::get(),
+             "TLB lookups, including the ones from the previous levels"),
+    ADD_STAT(lookupMisses, statistics::units::Count::get(),
+             "TLB lookups missing in this level")
 {
 }
 
@@ -593,15 +569,15 @@ void
 TLB::serialize(CheckpointOut &cp) const
 {
     // Only store the entries in use.
-    uint32_t _size = size - freeList.size();
+    uint32_t _size = tlb.occupancy();
     SERIALIZE_SCALAR(_size);
+    uint64_t lruSeq = tlb.lastSeq();
     SERIALIZE_SCALAR(lruSeq);
 
     uint32_t _count = 0;
-    for (uint32_t x = 0; x < size; x++) {
-        if (tlb[x].trieHandle != NULL)
-            tlb[x].serializeSection(cp, csprintf("Entry%d", _count++));
-    }
+    tlb.forEach([&](const TlbEntry &entry) {
+        entry.serializeSection(cp, csprintf("Entry%d", _count++));
+    });
 }
 
 void
@@ -614,22 +590,24 @@ TLB::unserialize(CheckpointIn &cp)
         fatal("TLB size less than the one in checkpoint!");
     }
 
+    uint64_t lruSeq;
     UNSERIALIZE_SCALAR(lruSeq);
 
+    // Keep the saved lruSeq of the entries, so that the replacement
+    // order is the same as when the checkpoint was taken.
+    std::vector<std::pair<Addr, TlbEntry>> saved;
     for (uint32_t x = 0; x < _size; x++) {
-        TlbEntry *newEntry = freeList.front();
-        freeList.pop_front();
-
-        newEntry->unserializeSection(cp, csprintf("Entry%d", x));
-        newEntry->trieHandle = trie.insert(newEntry->vaddr,
-            TlbEntryTrie::MaxBits - newEntry->logBytes, newEntry);
+        TlbEntry newEntry;
+        newEntry.unserializeSection(cp, csprintf("Entry%d", x));
+        saved.emplace_back(newEntry.vaddr, newEntry);
     }
+    tlb.restore(std::move(saved), lruSeq);
 }
 
 Port *
 TLB::getTableWalkerPort()
 {
-    return &walker->getPort("port");
+    return walker ? &walker->getPort("port") : nullptr;
 }
 
 } // namespace X86ISA
@@ -38,12 +38,10 @@
 #ifndef __ARCH_X86_TLB_HH__
 #define __ARCH_X86_TLB_HH__
 
-#include <list>
-#include <vector>
-
+#include "arch/generic/set_assoc_tlb.hh"
 #include "arch/generic/tlb.hh"
 #include "arch/x86/pagetable.hh"
-#include "base/trie.hh"
+#include "mem/cache/replacement_policies/base.hh"
 #include "mem/request.hh"
 #include "params/X86TLB.hh"
 #include "sim/stats.hh"
@@ -62,8 +60,6 @@ namespace X86ISA
       protected:
         friend class Walker;
 
-        typedef std::list<TlbEntry *> EntryList;
-
         uint32_t configAddress;
 
       public:
@@ -73,6 +69,11 @@ namespace X86ISA
 
         void takeOverFrom(BaseTLB *otlb) override {}
 
+        /**
+         * Look an entry up in this TLB and, on a miss, in the next
+         * levels of the hierarchy. Entries found in a next level are
+         * copied into this one unless update_lru is false.
+         */
         TlbEntry *lookup(Addr va, bool update_lru = true);
 
         void setConfigAddress(uint32_t addr);
@@ -84,8 +85,6 @@ namespace X86ISA
 
       protected:
 
-        EntryList::iterator lookupIt(Addr va, bool update_lru = true);
-
         Walker * walker;
 
       public:
@@ -100,12 +99,7 @@ namespace X86ISA
       protected:
         uint32_t size;
 
-        std::vector<TlbEntry> tlb;
-
-        EntryList freeList;
-
-        TlbEntryTrie trie;
-        uint64_t lruSeq;
+        SetAssocTlb<TlbEntry> tlb;
 
         AddrRange m5opRange;
 
@@ -117,8 +111,16 @@ namespace X86ISA
             statistics::Scalar wrAccesses;
             statistics::Scalar rdMisses;
             statistics::Scalar wrMisses;
+            statistics::Scalar lookups;
+            statistics::Scalar lookupMisses;
         } stats;
 
+        /** The next level TLB, if any */
+        TLB *nextLevelTlb() const { return static_cast<TLB *>(nextLevel()); }
+
+        /** Insert an entry in this TLB only */
+        TlbEntry *insertLocal(Addr vpn, const TlbEntry &entry);
+
         Fault translateInt(bool read, RequestPtr req, ThreadContext *tc);
 
         Fault translate(const RequestPtr &req, ThreadContext *tc,
@@ -127,14 +129,6 @@ namespace X86ISA
 
       public:
 
-        void evictLRU();
-
-        uint64_t
-        nextSeq()
-        {
-            return ++lruSeq;
-        }
-
         Fault translateAtomic(
             const RequestPtr &req, ThreadContext *tc,
             BaseMMU::Mode mode) override;
@@ -161,6 +155,10 @@ namespace X86ISA
         Fault finalizePhysical(const RequestPtr &req, ThreadContext *tc,
                                BaseMMU::Mode mode) const override;
 
+        /**
+         * Insert an entry in this TLB and in the next levels of the
+         * hierarchy (which are thus inclusive).
+         */
         TlbEntry *insert(Addr vpn, const TlbEntry &entry, uint64_t pcid);
 
         // Checkpointing
@@ -29,11 +29,17 @@
 #ifndef __CPU_DECODE_CACHE_HH__
 #define __CPU_DECODE_CACHE_HH__
 
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include "base/bitfield.hh"
 #include "base/compiler.hh"
-#include "cpu/static_inst_fwd.hh"
+#include "base/types.hh"
+#include "cpu/static_inst.hh"
 
 namespace gem5
 {
@@ -45,6 +51,147 @@ namespace decode_cache
 template <typename EMI>
 using InstMap = std::unordered_map<EMI, StaticInstPtr>;
 
+/**
+ * A hash of decoded instructions which can be shared by the decoders
+ * of several CPUs, possibly running on different host threads.
+ *
+ * Entries are never modified nor removed once inserted, which is
+ * enough for a decode cache and makes lookups lock free: a bucket is
+ * a singly linked list of immutable nodes to which insertions prepend
+ * new nodes with a compare and swap.
+ *
+ * Note that the reference counts of StaticInstPtr are not atomic, so
+ * concurrent copies of a pointer to the same instruction could lose
+ * updates and free it while still in use. Instructions are therefore
+ * made immortal (see StaticInst::makeImmortal) before being published
+ * by insert: their counts are no longer updated, and they live as long
+ * as the simulator.
+ */
+template <typename EMI, typename Hash = std::hash<EMI>>
+class SharedInstMap
+{
+  private:
+    struct Node
+    {
+        const EMI machInst;
+        const StaticInstPtr inst;
+        Node *next;
+    };
+
+    const unsigned bucketsLog2;
+    std::unique_ptr<std::atomic<Node *>[]> buckets;
+    std::atomic<size_t> numEntries;
+
+    std::atomic<Node *> &
+    bucket(const EMI &mach_inst) const
+    {
+        // Fibonacci hashing, as many std::hash implementations are the
+        // identity function, which would only use the low order bits.
+        const uint64_t hash = Hash()(mach_inst) * 0x9e3779b97f4a7c15ULL;
+        return buckets[hash >> (64 - bucketsLog2)];
+    }
+
+    /// Search the nodes from first (included) to last (excluded).
+    static const Node *
+    search(const Node *first, const Node *last, const EMI &mach_inst)
+    {
+        for (const Node *node = first; node != last; node = node->next) {
+            if (node->machInst == mach_inst)
+                return node;
+        }
+        return nullptr;
+    }
+
+  public:
+    /// @param buckets_log2 Log2 of the number of hash buckets.
+    explicit SharedInstMap(unsigned buckets_log2=16)
+      : bucketsLog2(buckets_log2),
+        buckets(new std::atomic<Node *>[1ULL << buckets_log2]),
+        numEntries(0)
+    {
+        for (uint64_t i = 0; i < (1ULL << bucketsLog2); i++)
+            buckets[i].store(nullptr, std::memory_order_relaxed);
+    }
+
+    SharedInstMap(const SharedInstMap &) = delete;
+    SharedInstMap &operator=(const SharedInstMap &) = delete;
+
+    ~SharedInstMap()
+    {
+        for (uint64_t i = 0; i < (1ULL << bucketsLog2); i++) {
+            Node *node = buckets[i].load(std::memory_order_relaxed);
+            while (node) {
+                Node *next = node->next;
+                delete node;
+                node = next;
+            }
+        }
+    }
+
+    /// Find a decoded instruction.
+    /// @retval The instruction, or a null pointer if it isn't cached.
+    StaticInstPtr
+    find(const EMI &mach_inst) const
+    {
+        const Node *node = search(
+                bucket(mach_inst).load(std::memory_order_acquire),
+                nullptr, mach_inst);
+        return node ? node->inst : StaticInstPtr();
+    }
+
+    /// Insert a decoded instruction, unless another thread inserted
+    /// one for the same machine instruction first.
+    /// @retval The instruction in the map, which all users should
+    ///         refer to from then on.
+    StaticInstPtr
+    insert(const EMI &mach_inst, const StaticInstPtr &inst)
+    {
+        std::atomic<Node *> &head = bucket(mach_inst);
+        Node *first = head.load(std::memory_order_acquire);
+        if (const Node *found = search(first, nullptr, mach_inst))
+            return found->inst;
+
+        // This leaks inst if another thread wins the race below, which
+        // is rare and bounded by the number of host threads.
+        inst->makeImmortal();
+        Node *node = new Node{mach_inst, inst, first};
+        while (!head.compare_exchange_weak(node->next, node,
+                    std::memory_order_acq_rel, std::memory_order_acquire)) {
+            // Only check the nodes which have been inserted since the
+            // last attempt.
+            if (const Node *found = search(node->next, first, mach_inst)) {
+                delete node;
+                return found->inst;
+            }
+            first = node->next;
+        }
+        numEntries.fetch_add(1, std::memory_order_relaxed);
+        return inst;
+    }
+
+    size_t size() const { return numEntries.load(std::memory_order_relaxed); }
+};
+
+/**
+ * Get the object of type T shared by all the decoders of type Owner
+ * (i.e. of the same ISA) which use the same key, e.g. the same
+ * decoding mode, creating it on first use. This is thread safe, and
+ * the returned object lives as long as the simulator.
+ */
+template <typename T, typename Owner, typename Key>
+T &
+shared(const Key &key)
+{
+    static std::mutex mutex;
+    static std::map<Key, std::unique_ptr<T>> objects;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    std::unique_ptr<T> &object = objects[key];
+    if (!object)
+        object = std::make_unique<T>();
+    return *object;
+}
+
 /// A sparse map from an Addr to a Value, stored in page chunks.
 template<class Value, Addr CacheChunkShift = 12>
 class AddrMap
@@ -64,6 +64,11 @@ class NopStaticInst : public StaticInst
 
 }
 
-StaticInstPtr nopStaticInstPtr = new NopStaticInst;
+// Shared by all the CPUs, including those running on other host threads.
+StaticInstPtr nopStaticInstPtr = [] {
+    StaticInst *nop = new NopStaticInst;
+    nop->makeImmortal();
+    return nop;
+}();
 
 } // namespace gem5
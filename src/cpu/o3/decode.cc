@@ -227,7 +227,7 @@ Decode::checkStall(ThreadID tid) const
 }
 
 bool
-Decode::fetchInstsValid()
+Decode::fetchInstsValid() const
 {
     return fromFetch->size > 0;
 }
@@ -539,6 +539,36 @@ Decode::checkSignalsAndUpdate(ThreadID tid)
     return false;
 }
 
+bool
+Decode::quiescent() const
+{
+    if (fetchInstsValid())
+        return false;
+
+    for (ThreadID tid : *activeThreads) {
+        if (fromRename->renameBlock[tid] || fromRename->renameUnblock[tid] ||
+            fromCommit->commitInfo[tid].squash || !insts[tid].empty()) {
+            return false;
+        }
+
+        // A blocked thread stays blocked while rename stalls it, and an
+        // idle or running thread with nothing to decode stays as it is
+        // while rename doesn't.
+        if (decodeStatus[tid] == Blocked) {
+            if (!stalls[tid].rename)
+                return false;
+        } else if (decodeStatus[tid] == Running ||
+                   decodeStatus[tid] == Idle) {
+            if (stalls[tid].rename)
+                return false;
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void
 Decode::tick()
 {
@@ -548,6 +578,18 @@ Decode::tick()
 
     toRenameIndex = 0;
 
+    // Skip the per thread processing if it can't change anything, only
+    // counting the cycle as it would have been.
+    if (quiescent()) {
+        for (ThreadID tid : *activeThreads) {
+            if (decodeStatus[tid] == Blocked)
+                ++stats.blockedCycles;
+            else
+                ++stats.idleCycles;
+        }
+        return;
+    }
+
     list<ThreadID>::iterator threads = activeThreads->begin();
     list<ThreadID>::iterator end = activeThreads->end();
 
@@ -173,11 +173,16 @@ class Decode
     /** Checks all input signals and updates decode's status appropriately. */
     bool checkSignalsAndUpdate(ThreadID tid);
 
+    /** Returns if nothing arrived this cycle and every thread is idle or
+     * blocked, so ticking decode could only update its cycle counts.
+     */
+    bool quiescent() const;
+
     /** Checks all stall signals, and returns if any are true. */
     bool checkStall(ThreadID tid) const;
 
     /** Returns if there any instructions from fetch on this cycle. */
-    bool fetchInstsValid();
+    bool fetchInstsValid() const;
 
     /** Switches decode to blocking, and signals back that decode has
      * become blocked.
@@ -45,7 +45,7 @@
 #include <algorithm>
 #include <array>
 #include <iostream>
-#include <queue>
+#include <vector>
 
 #include "base/logging.hh"
 #include "base/trace.hh"
@@ -72,39 +72,75 @@ class SimpleFreeList
 {
   private:
 
-    /** The actual free list */
-    std::queue<PhysRegIdPtr> freeRegs;
+    /** The actual free list, oldest first, kept as a ring. The ring
+     *  only grows while the register file is being set up; after that
+     *  it can hold every register of the class, so adding and removing
+     *  registers never allocates. */
+    std::vector<PhysRegIdPtr> freeRegs;
+
+    /** Position of the oldest free register in the ring. */
+    size_t head = 0;
+
+    /** Number of free registers in the ring. */
+    size_t numFree = 0;
+
+    /** Double the capacity of the ring, keeping the register order. */
+    void
+    grow()
+    {
+        std::vector<PhysRegIdPtr> regs;
+        regs.reserve(std::max<size_t>(16, freeRegs.size() * 2));
+        for (size_t i = 0; i < numFree; i++)
+            regs.push_back(freeRegs[(head + i) % freeRegs.size()]);
+        regs.resize(regs.capacity());
+
+        freeRegs.swap(regs);
+        head = 0;
+    }
 
   public:
 
     SimpleFreeList() {};
 
     /** Add a physical register to the free list */
-    void addReg(PhysRegIdPtr reg) { freeRegs.push(reg); }
+    void
+    addReg(PhysRegIdPtr reg)
+    {
+        if (numFree == freeRegs.size())
+            grow();
+
+        size_t tail = head + numFree;
+        if (tail >= freeRegs.size())
+            tail -= freeRegs.size();
+        freeRegs[tail] = reg;
+        numFree++;
+    }
 
     /** Add physical registers to the free list */
     template<class InputIt>
     void
     addRegs(InputIt first, InputIt last) {
         std::for_each(first, last, [this](typename InputIt::value_type& reg) {
-            freeRegs.push(&reg);
+            addReg(&reg);
         });
     }
 
     /** Get the next available register from the free list */
     PhysRegIdPtr getReg()
     {
-        assert(!freeRegs.empty());
-        PhysRegIdPtr free_reg = freeRegs.front();
-        freeRegs.pop();
+        assert(numFree != 0);
+        PhysRegIdPtr free_reg = freeRegs[head];
+        if (++head == freeRegs.size())
+            head = 0;
+        numFree--;
         return free_reg;
     }
 
     /** Return the number of free registers on the list. */
-    unsigned numFreeRegs() const { return freeRegs.size(); }
+    unsigned numFreeRegs() const { return numFree; }
 
     /** True iff there are free registers on the list. */
-    bool hasFreeRegs() const { return !freeRegs.empty(); }
+    bool hasFreeRegs() const { return numFree != 0; }
 };
 
 
@@ -42,6 +42,7 @@
 #include "cpu/o3/lsq_unit.hh"
 
 #include "arch/generic/debugfaults.hh"
+#include "base/intmath.hh"
 #include "base/str.hh"
 #include "cpu/checker/cpu.hh"
 #include "cpu/o3/dyn_inst.hh"
@@ -239,6 +240,83 @@ LSQUnit::resetState()
     stalled = false;
 
     cacheBlockMask = ~(cpu->cacheLineSize() - 1);
+
+    // Index by whole cache lines, but never more finely than the
+    // granularity of the dependence checks so that any two accesses
+    // checkViolations considers overlapping share a line.
+    unsigned line_shift = std::max<unsigned>(
+            floorLog2(cpu->cacheLineSize()), depCheckShift);
+    storeIndex.init(line_shift);
+    loadIndex.init(line_shift);
+}
+
+void
+LSQUnit::LineIndex::insert(size_t idx, Addr addr, uint32_t size)
+{
+    Addr last = (addr + size - 1) >> lineShift;
+    for (Addr line = addr >> lineShift; line <= last; ++line)
+        lines[line].push_back(idx);
+}
+
+void
+LSQUnit::LineIndex::remove(size_t idx, Addr addr, uint32_t size)
+{
+    Addr last = (addr + size - 1) >> lineShift;
+    for (Addr line = addr >> lineShift; line <= last; ++line) {
+        auto it = lines.find(line);
+        assert(it != lines.end());
+
+        auto &idxs = it->second;
+        auto pos = std::find(idxs.begin(), idxs.end(), idx);
+        assert(pos != idxs.end());
+        idxs.erase(pos);
+
+        if (idxs.empty())
+            lines.erase(it);
+    }
+}
+
+void
+LSQUnit::LineIndex::find(Addr addr, uint32_t size,
+        std::vector<size_t> &idxs) const
+{
+    idxs.clear();
+
+    Addr first = addr >> lineShift;
+    Addr last = (addr + std::max<uint32_t>(size, 1) - 1) >> lineShift;
+    for (Addr line = first; line <= last; ++line) {
+        auto it = lines.find(line);
+        if (it != lines.end())
+            idxs.insert(idxs.end(), it->second.begin(), it->second.end());
+    }
+
+    std::sort(idxs.begin(), idxs.end());
+    if (first != last)
+        idxs.erase(std::unique(idxs.begin(), idxs.end()), idxs.end());
+}
+
+void
+LSQUnit::addToIndex(LineIndex &index, LSQEntry &entry, size_t idx,
+        Addr addr, uint32_t size)
+{
+    size = std::max<uint32_t>(size, 1);
+    if (entry.indexedSize() == size && entry.indexedAddr() == addr)
+        return;
+
+    removeFromIndex(index, entry, idx);
+    index.insert(idx, addr, size);
+    entry.indexedAddr() = addr;
+    entry.indexedSize() = size;
+}
+
+void
+LSQUnit::removeFromIndex(LineIndex &index, LSQEntry &entry, size_t idx)
+{
+    if (entry.indexedSize() == 0)
+        return;
+
+    index.remove(idx, entry.indexedAddr(), entry.indexedSize());
+    entry.indexedSize() = 0;
 }
 
 std::string
@@ -517,13 +595,18 @@ LSQUnit::checkViolations(typename LoadQueue::iterator& loadIt,
      * however, there isn't a good way in the pipeline at the moment to check
      * all instructions that will execute before the store writes back. Thus,
      * like the implementation that came before it, we're overly conservative.
+     *
+     * Only the loads from loadIt onwards that access the same lines as
+     * inst can overlap it, so visit those, oldest first.
      */
-    while (loadIt != loadQueue.end()) {
-        DynInstPtr ld_inst = loadIt->instruction();
-        if (!ld_inst->effAddrValid() || ld_inst->strictlyOrdered()) {
-            ++loadIt;
+    loadIndex.find(inst->effAddr, inst->effSize, indexMatches);
+    for (size_t ld_idx : indexMatches) {
+        if (ld_idx < loadIt.idx())
+            continue;
+
+        DynInstPtr ld_inst = loadQueue[ld_idx].instruction();
+        if (!ld_inst->effAddrValid() || ld_inst->strictlyOrdered())
             continue;
-        }
 
         Addr ld_eff_addr1 = ld_inst->effAddr >> depCheckShift;
         Addr ld_eff_addr2 =
@@ -577,8 +660,6 @@ LSQUnit::checkViolations(typename LoadQueue::iterator& loadIt,
                     inst->seqNum, ld_inst->seqNum, ld_eff_addr1);
             }
         }
-
-        ++loadIt;
     }
     return NoFault;
 }
@@ -734,6 +815,7 @@ LSQUnit::commitLoad()
                     inst->lastWakeDependents - inst->firstIssue));
     }
 
+    removeFromIndex(loadIndex, loadQueue.front(), loadQueue.head());
     loadQueue.front().clear();
     loadQueue.pop_front();
 }
@@ -954,6 +1036,7 @@ LSQUnit::squash(const InstSeqNum &squashed_num)
         }
         // Clear the smart pointer to make sure it is decremented.
         loadQueue.back().instruction()->setSquashed();
+        removeFromIndex(loadIndex, loadQueue.back(), loadQueue.tail());
         loadQueue.back().clear();
 
         loadQueue.pop_back();
@@ -1025,6 +1108,7 @@ LSQUnit::squash(const InstSeqNum &squashed_num)
         // Must delete request now that it wasn't handed off to
         // memory.  This is quite ugly.  @todo: Figure out the proper
         // place to really handle request deletes.
+        removeFromIndex(storeIndex, storeQueue.back(), storeQueue.tail());
         storeQueue.back().clear();
 
         storeQueue.pop_back();
@@ -1149,6 +1233,8 @@ LSQUnit::completeStore(typename StoreQueue::iterator store_idx)
     DynInstPtr store_inst = store_idx->instruction();
     if (store_idx == storeQueue.begin()) {
         do {
+            removeFromIndex(storeIndex, storeQueue.front(),
+                    storeQueue.head());
             storeQueue.front().clear();
             storeQueue.pop_front();
         } while (storeQueue.front().completed() &&
@@ -1324,6 +1410,9 @@ LSQUnit::read(LSQRequest *request, ssize_t load_idx)
 
     assert(!load_inst->isExecuted());
 
+    addToIndex(loadIndex, load_entry, load_idx, load_inst->effAddr,
+            load_inst->effSize);
+
     // Make sure this isn't a strictly ordered load
     // A bit of a hackish way to get strictly ordered accesses to work
     // only if they're at the head of the LSQ and are ready to commit
@@ -1382,13 +1471,25 @@ LSQUnit::read(LSQRequest *request, ssize_t load_idx)
         return NoFault;
     }
 
-    // Check the SQ for any previous stores that might lead to forwarding
-    auto store_it = load_inst->sqIt;
-    assert (store_it >= storeWBIt);
-    // End once we've reached the top of the LSQ
-    while (store_it != storeWBIt && !load_inst->isDataPrefetch()) {
-        // Move the index to one younger
-        store_it--;
+    // Check the SQ for any previous stores that might lead to forwarding.
+    // Only the stores that access the same lines as the load can overlap
+    // it, so visit those, youngest first, from the load's position up to
+    // the top of the LSQ.
+    assert (load_inst->sqIt >= storeWBIt);
+    if (load_inst->isDataPrefetch())
+        indexMatches.clear();
+    else
+        storeIndex.find(request->mainReq()->getVaddr(),
+                request->mainReq()->getSize(), indexMatches);
+    for (auto match = indexMatches.rbegin(); match != indexMatches.rend();
+            ++match) {
+        if (*match >= load_inst->sqIt.idx())
+            continue;
+        // End once we've reached the top of the LSQ
+        if (*match < storeWBIt.idx())
+            break;
+
+        auto store_it = storeQueue.getIterator(*match);
         assert(store_it->valid());
         assert(store_it->instruction()->seqNum < load_inst->seqNum);
         int store_size = store_it->size();
@@ -1613,6 +1714,8 @@ LSQUnit::write(LSQRequest *request, uint8_t *data, ssize_t store_idx)
     storeQueue[store_idx].setRequest(request);
     unsigned size = request->_size;
     storeQueue[store_idx].size() = size;
+    addToIndex(storeIndex, storeQueue[store_idx], store_idx,
+            storeQueue[store_idx].instruction()->effAddr, size);
     bool store_no_data =
         request->mainReq()->getFlags() & Request::STORE_NO_DATA;
     storeQueue[store_idx].isAllZeros() = store_no_data;
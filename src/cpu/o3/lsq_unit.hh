@@ -47,6 +47,8 @@
 #include <map>
 #include <memory>
 #include <queue>
+#include <unordered_map>
+#include <vector>
 
 #include "arch/generic/debugfaults.hh"
 #include "arch/generic/vec_reg.hh"
@@ -103,6 +105,10 @@ class LSQUnit
         uint32_t _size = 0;
         /** Valid entry. */
         bool _valid = false;
+        /** Address range the entry is recorded under in its line index,
+         * a size of 0 means it isn't recorded. */
+        Addr _indexedAddr = 0;
+        uint32_t _indexedSize = 0;
 
       public:
         ~LSQEntry()
@@ -123,6 +129,8 @@ class LSQUnit
             _request = nullptr;
             _valid = false;
             _size = 0;
+            _indexedAddr = 0;
+            _indexedSize = 0;
         }
 
         void
@@ -143,6 +151,8 @@ class LSQUnit
         uint32_t& size() { return _size; }
         const uint32_t& size() const { return _size; }
         const DynInstPtr& instruction() const { return _inst; }
+        Addr& indexedAddr() { return _indexedAddr; }
+        uint32_t& indexedSize() { return _indexedSize; }
         /** @} */
     };
 
@@ -204,6 +214,35 @@ class LSQUnit
         NoAddrRangeCoverage /* Two ranges are disjoint */
     };
 
+    /**
+     * Index of the queue entries whose addresses are known, by the lines
+     * they access. Forwarding and ordering checks use it to visit only
+     * the entries that can overlap an access instead of walking the
+     * whole queue. Entries are named by their queue index, which only
+     * grows, so sorting them also sorts them by age.
+     */
+    class LineIndex
+    {
+      private:
+        std::unordered_map<Addr, std::vector<size_t>> lines;
+        unsigned lineShift = 0;
+
+      public:
+        void
+        init(unsigned line_shift)
+        {
+            lines.clear();
+            lineShift = line_shift;
+        }
+
+        void insert(size_t idx, Addr addr, uint32_t size);
+        void remove(size_t idx, Addr addr, uint32_t size);
+
+        /** Get the indices of the entries that touch any of the lines
+         * of [addr, addr + size), oldest first. */
+        void find(Addr addr, uint32_t size, std::vector<size_t> &idxs) const;
+    };
+
   public:
     using LoadQueue = CircularQueue<LQEntry>;
     using StoreQueue = CircularQueue<SQEntry>;
@@ -452,6 +491,21 @@ class LSQUnit
     LoadQueue loadQueue;
 
   private:
+    /** The stores and loads whose addresses are known, by line. */
+    LineIndex storeIndex;
+    LineIndex loadIndex;
+
+    /** Scratch space for index lookups. */
+    std::vector<size_t> indexMatches;
+
+    /** Record a queue entry in an index, or move it if it was recorded
+     * with a different address range. */
+    void addToIndex(LineIndex &index, LSQEntry &entry, size_t idx,
+            Addr addr, uint32_t size);
+
+    /** Drop a queue entry from an index before it leaves its queue. */
+    void removeFromIndex(LineIndex &index, LSQEntry &entry, size_t idx);
+
     /** The number of places to shift addresses in the LSQ before checking
      * for dependency violations
      */
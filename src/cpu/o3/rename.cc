@@ -388,6 +388,50 @@ Rename::squash(const InstSeqNum &squash_seq_num, ThreadID tid)
     doSquash(squash_seq_num, tid);
 }
 
+bool
+Rename::quiescent()
+{
+    if (fromDecode->size != 0)
+        return false;
+
+    // Nothing from IEW or commit that would update the free entries, the
+    // stall signals, the in progress counts or the history.
+    for (ThreadID tid = 0; tid < numThreads; tid++) {
+        const auto &iew_info = fromIEW->iewInfo[tid];
+        const auto &commit_info = fromCommit->commitInfo[tid];
+
+        if (iew_info.usedIQ || iew_info.usedLSQ || iew_info.dispatched ||
+            iew_info.dispatchedToLQ || iew_info.dispatchedToSQ ||
+            fromIEW->iewBlock[tid] || fromIEW->iewUnblock[tid] ||
+            commit_info.squash || commit_info.usedROB ||
+            commit_info.doneSeqNum != 0 ||
+            !freeingInProgress[tid].empty()) {
+            return false;
+        }
+    }
+
+    for (ThreadID tid : *activeThreads) {
+        if (!insts[tid].empty())
+            return false;
+
+        // A blocked thread stays blocked while it is stalled, and an idle
+        // or running thread with nothing to rename stays as it is while
+        // it isn't.
+        if (renameStatus[tid] == Blocked) {
+            if (!checkStall(tid))
+                return false;
+        } else if (renameStatus[tid] == Running ||
+                   renameStatus[tid] == Idle) {
+            if (checkStall(tid))
+                return false;
+        } else {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void
 Rename::tick()
 {
@@ -399,6 +443,18 @@ Rename::tick()
 
     toIEWIndex = 0;
 
+    // Skip the per thread processing if it can't change anything, only
+    // counting the cycle as it would have been.
+    if (quiescent()) {
+        for (ThreadID tid : *activeThreads) {
+            if (renameStatus[tid] == Blocked)
+                ++stats.blockCycles;
+            else
+                ++stats.idleCycles;
+        }
+        return;
+    }
+
     sortInsts();
 
     std::list<ThreadID>::iterator threads = activeThreads->begin();
@@ -275,6 +275,11 @@ class Rename
     /** Checks if any stages are telling rename to block. */
     bool checkStall(ThreadID tid);
 
+    /** Returns if nothing arrived this cycle and every thread is idle or
+     * blocked, so ticking rename could only update its cycle counts.
+     */
+    bool quiescent();
+
     /** Gets the number of free entries for a specific thread. */
     void readFreeEntries(ThreadID tid);
 
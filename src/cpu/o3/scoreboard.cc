@@ -37,7 +37,9 @@ namespace o3
 
 Scoreboard::Scoreboard(const std::string &_my_name,
         unsigned _numPhysicalRegs) :
-    _name(_my_name), regScoreBoard(_numPhysicalRegs, true),
+    _name(_my_name),
+    regScoreBoard((_numPhysicalRegs + BitsPerWord - 1) / BitsPerWord,
+            ~0ULL),
     numPhysRegs(_numPhysicalRegs)
 {}
 
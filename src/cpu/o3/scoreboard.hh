@@ -31,6 +31,7 @@
 #define __CPU_O3_SCOREBOARD_HH__
 
 #include <cassert>
+#include <cstdint>
 #include <vector>
 
 #include "base/compiler.hh"
@@ -59,8 +60,16 @@ class Scoreboard
     const std::string _name;
 
     /** Scoreboard of physical integer registers, saying whether or not they
-     *  are ready. */
-    std::vector<bool> regScoreBoard;
+     *  are ready, one bit per register packed into words. */
+    std::vector<uint64_t> regScoreBoard;
+
+    static constexpr unsigned BitsPerWord = 64;
+
+    static uint64_t
+    regBit(RegIndex flat_index)
+    {
+        return 1ULL << (flat_index % BitsPerWord);
+    }
 
     /** The number of actual physical registers */
     GEM5_CLASS_VAR_USED unsigned numPhysRegs;
@@ -89,7 +98,8 @@ class Scoreboard
 
         assert(phys_reg->flatIndex() < numPhysRegs);
 
-        return regScoreBoard[phys_reg->flatIndex()];
+        return regScoreBoard[phys_reg->flatIndex() / BitsPerWord] &
+            regBit(phys_reg->flatIndex());
     }
 
     /** Sets the register as ready. */
@@ -107,7 +117,8 @@ class Scoreboard
         DPRINTF(Scoreboard, "Setting reg %i (%s) as ready\n",
                 phys_reg->index(), phys_reg->className());
 
-        regScoreBoard[phys_reg->flatIndex()] = true;
+        regScoreBoard[phys_reg->flatIndex() / BitsPerWord] |=
+            regBit(phys_reg->flatIndex());
     }
 
     /** Sets the register as not ready. */
@@ -122,7 +133,8 @@ class Scoreboard
 
         assert(phys_reg->flatIndex() < numPhysRegs);
 
-        regScoreBoard[phys_reg->flatIndex()] = false;
+        regScoreBoard[phys_reg->flatIndex() / BitsPerWord] &=
+            ~regBit(phys_reg->flatIndex());
     }
 
 };
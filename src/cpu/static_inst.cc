@@ -35,6 +35,20 @@
 namespace gem5
 {
 
+void
+StaticInst::makeImmortal()
+{
+    if (isMacroop()) {
+        for (MicroPC upc = 0; ; upc++) {
+            StaticInstPtr microop = fetchMicroop(upc);
+            microop->makeImmortal();
+            if (microop->isLastMicroop())
+                break;
+        }
+    }
+    immortal = true;
+}
+
 StaticInstPtr
 StaticInst::fetchMicroop(MicroPC upc) const
 {
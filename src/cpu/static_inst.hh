@@ -113,7 +113,38 @@ class StaticInst : public RefCounted, public StaticInstFlags
 
     std::array<uint8_t, MiscRegClass + 1> _numTypedDestRegs = {};
 
+    /// See makeImmortal().
+    bool immortal = false;
+
   public:
+    /// @name Reference counting.
+    /// These hide the RefCounted versions, which StaticInstPtr would
+    /// otherwise use.
+    //@{
+    void
+    incref() const
+    {
+        if (!immortal)
+            RefCounted::incref();
+    }
+
+    void
+    decref() const
+    {
+        if (!immortal)
+            RefCounted::decref();
+    }
+    //@}
+
+    /**
+     * Stop reference counting this instruction and its microops, which
+     * are then never freed. Instructions shared by the decoders of CPUs
+     * running on different host threads must be made immortal before
+     * being published, as reference counts aren't atomic and concurrent
+     * updates could free an instruction still in use.
+     */
+    void makeImmortal();
+
 
     /// @name Register information.
     /// The sum of the different numDestRegs([type])-s equals numDestRegs().
@@ -63,6 +63,8 @@ class BaseTLB;
 class CheckerCPU;
 class Checkpoint;
 class InstDecoder;
+class MemBackdoor;
+class MemBackdoorReq;
 class PortProxy;
 class Process;
 class System;
@@ -144,6 +146,9 @@ class ThreadContext : public PCEventScope
 
     virtual void sendFunctional(PacketPtr pkt);
 
+    virtual void sendMemBackdoorReq(const MemBackdoorReq &req,
+                                    MemBackdoor *&backdoor);
+
     virtual Process *getProcessPtr() = 0;
 
     virtual void setProcessPtr(Process *p) = 0;
@@ -80,6 +80,7 @@ ComputeUnit::ComputeUnit(const Params &p) : ClockedObject(p),
     scalarMemoryPipe(p, *this),
     tickEvent([this]{ exec(); }, "Compute unit tick event",
           false, Event::CPU_Tick_Pri),
+    memSleepTick(MaxTick),
     cu_id(p.cu_id),
     vrf(p.vector_register_file), srf(p.scalar_register_file),
     simdWidth(p.simd_width),
@@ -438,7 +439,9 @@ void
 ComputeUnit::dispWorkgroup(HSAQueueEntry *task, int num_wfs_in_wg)
 {
     // If we aren't ticking, start it up!
-    if (!tickEvent.scheduled()) {
+    if (isSleepingOnMemory()) {
+        wakeup();
+    } else if (!tickEvent.scheduled()) {
         DPRINTF(GPUDisp, "CU%d: Scheduling wakeup next cycle\n", cu_id);
         schedule(tickEvent, nextCycle());
     }
@@ -758,14 +761,57 @@ ComputeUnit::exec()
     stats.totalCycles++;
 
     // Put this CU to sleep if there is no more work to be done.
-    if (!isDone()) {
-        schedule(tickEvent, nextCycle());
-    } else {
+    if (isDone()) {
         shader->notifyCuSleep();
         DPRINTF(GPUDisp, "CU%d: Going to sleep\n", cu_id);
+    } else if (isWaitingOnMemory()) {
+        // Nothing can happen until a memory response arrives, so stop
+        // ticking instead of spinning through the pipeline stages. The
+        // CU is still active as far as the shader is concerned.
+        memSleepTick = nextCycle();
+        DPRINTF(GPUDisp, "CU%d: Sleeping until a memory response\n", cu_id);
+    } else {
+        schedule(tickEvent, nextCycle());
     }
 }
 
+bool
+ComputeUnit::isWaitingOnMemory() const
+{
+    for (int i = 0; i < numVectorALUs; ++i) {
+        for (int i_wf = 0; i_wf < shader->n_wf; ++i_wf) {
+            Wavefront *wf = wfList[i][i_wf];
+            if (wf->getStatus() != Wavefront::S_STOPPED &&
+                !wf->waitingOnMemory()) {
+                return false;
+            }
+        }
+    }
+
+    return fetchStage.isIdle() && scheduleStage.isIdle() &&
+           globalMemoryPipe.isIdle() && localMemoryPipe.isIdle() &&
+           scalarMemoryPipe.isIdle();
+}
+
+void
+ComputeUnit::wakeup()
+{
+    if (!isSleepingOnMemory()) {
+        return;
+    }
+
+    // Account for the cycles skipped while asleep as if the CU had been
+    // ticking, so that totalCycles and the per-cycle rates are unchanged.
+    Tick next_cycle = nextCycle();
+    Cycles slept((next_cycle - memSleepTick) / clockPeriod());
+    stats.totalCycles += slept;
+    stats.memSleepCycles += slept;
+    memSleepTick = MaxTick;
+
+    DPRINTF(GPUDisp, "CU%d: Waking up after %d cycles\n", cu_id, slept);
+    schedule(tickEvent, next_cycle);
+}
+
 void
 ComputeUnit::init()
 {
@@ -958,6 +1004,8 @@ ComputeUnit::ScalarDataPort::handleResponse(PacketPtr pkt)
                 computeUnit->scalarMemoryPipe.getGMStRespFIFO().push(
                                 gpuDynInst);
         }
+
+        computeUnit->wakeup();
     }
 
     delete pkt->senderState;
@@ -2124,6 +2172,7 @@ ComputeUnit::LDSPort::recvTimingResp(PacketPtr packet)
     delete packet;
 
     computeUnit->localMemoryPipe.getLMRespFIFO().push(gpuDynInst);
+    computeUnit->wakeup();
     return true;
 }
 
@@ -2352,6 +2401,8 @@ ComputeUnit::ComputeUnitStats::ComputeUnitStats(statistics::Group *parent,
       ADD_STAT(numVecOpsExecutedTwoOpFP,
                "number of two op FP vec ops executed (e.g. WF size/inst)"),
       ADD_STAT(totalCycles, "number of cycles the CU ran for"),
+      ADD_STAT(memSleepCycles, "number of cycles the CU did not tick "
+               "because all of its wavefronts were waiting on memory"),
       ADD_STAT(vpc, "Vector Operations per cycle (this CU only)"),
       ADD_STAT(vpc_f16, "F16 Vector Operations per cycle (this CU only)"),
       ADD_STAT(vpc_f32, "F32 Vector Operations per cycle (this CU only)"),
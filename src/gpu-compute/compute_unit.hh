@@ -286,6 +286,9 @@ class ComputeUnit : public ClockedObject
     ScalarMemPipeline scalarMemoryPipe;
 
     EventFunctionWrapper tickEvent;
+    // Tick at which the CU would have ticked next when it went to sleep
+    // waiting on memory, or MaxTick if it is not sleeping on memory.
+    Tick memSleepTick;
 
     typedef ComputeUnitParams Params;
     std::vector<std::vector<Wavefront*>> wfList;
@@ -465,6 +468,20 @@ class ComputeUnit : public ClockedObject
     bool isDone() const;
     bool isVectorAluIdle(uint32_t simdId) const;
 
+    /**
+     * Returns true if every resident WF is waiting on memory (or is
+     * stopped) and no pipeline stage has work left, i.e., ticking the
+     * CU cannot make progress until a memory response arrives.
+     */
+    bool isWaitingOnMemory() const;
+    bool isSleepingOnMemory() const { return memSleepTick != MaxTick; }
+
+    /**
+     * Restart the tick event of a CU sleeping on memory. This is called
+     * whenever a memory or fetch response is returned to the CU.
+     */
+    void wakeup();
+
     void handleSQCReturn(PacketPtr pkt);
 
   protected:
@@ -1111,6 +1128,8 @@ class ComputeUnit : public ClockedObject
         statistics::Scalar numVecOpsExecutedTwoOpFP;
         // Total cycles that something is running on the GPU
         statistics::Scalar totalCycles;
+        // Cycles the CU skipped while all its WFs were waiting on memory
+        statistics::Scalar memSleepCycles;
         statistics::Formula vpc; // vector ops per cycle
         statistics::Formula vpc_f16; // vector ops per cycle
         statistics::Formula vpc_f32; // vector ops per cycle
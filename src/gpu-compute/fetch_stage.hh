@@ -60,6 +60,7 @@ class FetchStage
     void exec();
     void processFetchReturn(PacketPtr pkt);
     void fetch(PacketPtr pkt, Wavefront *wave);
+    bool isIdle() const;
 
     // Stats related variables and methods
     const std::string& name() const { return _name; }
@@ -132,6 +132,33 @@ FetchUnit::exec()
     }
 }
 
+bool
+FetchUnit::isIdle() const
+{
+    if (!fetchQueue.empty()) {
+        return false;
+    }
+
+    for (int j = 0; j < computeUnit.shader->n_wf; ++j) {
+        if (!fetchBuf[j].isIdle()) {
+            return false;
+        }
+
+        // same check exec() uses to put a wave on the fetch queue
+        Wavefront *curWave = fetchStatusQueue[j].first;
+        if (!fetchStatusQueue[j].second &&
+            (curWave->getStatus() == Wavefront::S_RUNNING ||
+            curWave->getStatus() == Wavefront::S_WAITCNT) &&
+            fetchBuf[j].hasFreeSpace() &&
+            !curWave->stopFetch() &&
+            !curWave->pendingFetch) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 void
 FetchUnit::initiateFetch(Wavefront *wavefront)
 {
@@ -327,6 +354,8 @@ FetchUnit::processFetchReturn(PacketPtr pkt)
 
     delete pkt->senderState;
     delete pkt;
+
+    computeUnit.wakeup();
 }
 
 void
@@ -556,6 +585,28 @@ FetchUnit::FetchBufDesc::checkWaveReleaseBuf()
     }
 }
 
+bool
+FetchUnit::FetchBufDesc::isIdle() const
+{
+    if (hasFetchDataToProcess() && (splitDecode() ||
+        wavefront->instructionBuffer.size() < maxIbSize)) {
+        return false;
+    }
+
+    if (hasFreeSpace()) {
+        return true;
+    }
+
+    // see checkWaveReleaseBuf(), a line can be released once the wave's
+    // PC has moved past the oldest buffered line
+    Addr cur_wave_pc = roundDown(wavefront->pc(),
+                                 wavefront->computeUnit->cacheLineSize());
+    auto current_buffered_pc = bufferedPCs.find(cur_wave_pc);
+
+    return current_buffered_pc == bufferedPCs.end()
+        || current_buffered_pc == bufferedPCs.begin();
+}
+
 void
 FetchUnit::FetchBufDesc::decodeInsts()
 {
@@ -64,6 +64,12 @@ class FetchUnit
     void fetch(PacketPtr pkt, Wavefront *wavefront);
     void processFetchReturn(PacketPtr pkt);
     void flushBuf(int wfSlotId);
+    /**
+     * returns true if ticking this fetch unit would do nothing, i.e.,
+     * no buffered instructions can be decoded, no fetch buffer entry
+     * can be released, and no wave is ready to issue a fetch.
+     */
+    bool isIdle() const;
     static uint32_t globalFetchUnitID;
 
   private:
@@ -157,6 +163,12 @@ class FetchUnit
          */
         void decodeInsts();
 
+        /**
+         * returns true if decodeInsts() and checkWaveReleaseBuf() would
+         * not change the state of this fetch buffer.
+         */
+        bool isIdle() const;
+
         /**
          * checks if the wavefront can release any of its fetch
          * buffer entries. this will occur when the WF's PC goes
@@ -310,6 +310,8 @@ GlobalMemPipeline::handleResponse(GPUDynInstPtr gpuDynInst)
     // buffer
     assert(mem_req != gmOrderedRespBuffer.end());
     mem_req->second.second = true;
+
+    computeUnit.wakeup();
 }
 
 GlobalMemPipeline::
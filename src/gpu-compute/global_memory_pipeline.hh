@@ -97,6 +97,18 @@ class GlobalMemPipeline
         return (gmIssuedRequests.size() + pendReqs) < gmQueueSize;
     }
 
+    /**
+     * Returns true if there are no requests to issue, and the oldest
+     * response in the ordered buffer (if any) has not come back yet,
+     * i.e., the pipeline is only waiting on memory.
+     */
+    bool
+    isIdle() const
+    {
+        return gmIssuedRequests.empty() && (gmOrderedRespBuffer.empty() ||
+               !gmOrderedRespBuffer.begin()->second.second);
+    }
+
     const std::string &name() const { return _name; }
     void
     incLoadVRFBankConflictCycles(int num_cycles)
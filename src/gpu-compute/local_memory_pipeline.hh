@@ -76,6 +76,16 @@ class LocalMemPipeline
         return (lmIssuedRequests.size() + pendReqs) < lmQueueSize;
     }
 
+    /**
+     * Returns true if there are no requests to issue to, or
+     * responses returned from, the LDS.
+     */
+    bool
+    isIdle() const
+    {
+        return lmIssuedRequests.empty() && lmReturnedRequests.empty();
+    }
+
     const std::string& name() const { return _name; }
 
     void
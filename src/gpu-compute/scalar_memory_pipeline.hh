@@ -85,6 +85,17 @@ class ScalarMemPipeline
         return (issuedRequests.size() + pendReqs) < queueSize;
     }
 
+    /**
+     * Returns true if there are no requests to issue, and no returned
+     * loads or stores to complete.
+     */
+    bool
+    isIdle() const
+    {
+        return issuedRequests.empty() && returnedLoads.empty() &&
+               returnedStores.empty();
+    }
+
     const std::string& name() const { return _name; }
 
   private:
@@ -114,6 +114,12 @@ class ScheduleStage
     // Called by ExecStage to inform SCH of instruction execution
     void deleteFromSch(Wavefront *w);
 
+    /**
+     * Returns true if no wave has an instruction in the schedule
+     * stage or on its way to the execute stage.
+     */
+    bool isIdle() const { return wavesInSch.empty(); }
+
     // Schedule List status
     enum SCH_STATUS
     {
@@ -268,7 +268,8 @@ Shader::dispatchWorkgroups(HSAQueueEntry *task)
             DPRINTF(GPUWgLatency, "WG Begin cycle:%d wg:%d cu:%d\n",
                     curTick(), task->globalWgId(), curCu);
 
-            if (!cuList[curCu]->tickEvent.scheduled()) {
+            if (!cuList[curCu]->tickEvent.scheduled() &&
+                !cuList[curCu]->isSleepingOnMemory()) {
                 if (!_activeCus)
                     _lastInactiveTick = curTick();
                 _activeCus++;
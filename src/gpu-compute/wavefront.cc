@@ -1270,6 +1270,19 @@ Wavefront::waitCntsSatisfied()
     return true;
 }
 
+bool
+Wavefront::waitingOnMemory() const
+{
+    if (status == S_WAITCNT) {
+        // the waitcnt must have been executed, and one of the counts
+        // decremented by memory responses must still be outstanding
+        return (vmWaitCnt != -1 && vmemInstsIssued > vmWaitCnt) ||
+               (lgkmWaitCnt != -1 && lgkmInstsIssued > lgkmWaitCnt);
+    }
+
+    return status == S_RUNNING && instructionBuffer.empty() && pendingFetch;
+}
+
 bool
 Wavefront::sleepDone()
 {
@@ -269,6 +269,13 @@ class Wavefront : public SimObject
     void discardFetch();
 
     bool waitCntsSatisfied();
+    /**
+     * Returns true if this WF cannot make progress until a response
+     * comes back from memory, i.e., it is blocked on a waitcnt whose
+     * memory counts are not satisfied, or it has run out of instructions
+     * and is waiting on an instruction fetch.
+     */
+    bool waitingOnMemory() const;
     void setWaitCnts(int vm_wait_cnt, int exp_wait_cnt, int lgkm_wait_cnt);
     void clearWaitCnts();
 
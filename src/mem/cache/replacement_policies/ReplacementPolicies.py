@@ -79,6 +79,17 @@ class LRURP(BaseReplacementPolicy):
     cxx_header = "mem/cache/replacement_policies/lru_rp.hh"
 
 
+class ListLRURP(BaseReplacementPolicy):
+    type = "ListLRURP"
+    cxx_class = "gem5::replacement_policy::ListLRU"
+    cxx_header = "mem/cache/replacement_policies/list_lru_rp.hh"
+    mru_range = Param.Unsigned(
+        0,
+        "Number of entries after the most recently used one which are not "
+        "moved to the head of the list when touched",
+    )
+
+
 class BIPRP(LRURP):
     type = "BIPRP"
     cxx_class = "gem5::replacement_policy::BIP"
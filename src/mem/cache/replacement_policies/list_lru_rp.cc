@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/cache/replacement_policies/list_lru_rp.hh"
+
+#include <cassert>
+#include <memory>
+
+#include "params/ListLRURP.hh"
+
+namespace gem5
+{
+
+namespace replacement_policy
+{
+
+ListLRU::ListLRU(const Params &p)
+  : Base(p), order(p.mru_range)
+{
+}
+
+void
+ListLRU::invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
+{
+    // Invalid entries stay where they are in the list
+}
+
+void
+ListLRU::touch(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    auto data = std::static_pointer_cast<ListLRUReplData>(replacement_data);
+    data->stamp = order.touch(data->stamp);
+}
+
+void
+ListLRU::reset(const std::shared_ptr<ReplacementData>& replacement_data) const
+{
+    std::static_pointer_cast<ListLRUReplData>(
+        replacement_data)->stamp = order.moveToHead();
+}
+
+ReplaceableEntry*
+ListLRU::getVictim(const ReplacementCandidates& candidates) const
+{
+    // There must be at least one replacement candidate
+    assert(candidates.size() > 0);
+
+    // Visit all candidates to find victim, the first one wins ties
+    // (which only happen between entries that were never inserted)
+    ReplaceableEntry* victim = candidates[0];
+    for (const auto& candidate : candidates) {
+        if (std::static_pointer_cast<ListLRUReplData>(
+                    candidate->replacementData)->stamp <
+                std::static_pointer_cast<ListLRUReplData>(
+                    victim->replacementData)->stamp) {
+            victim = candidate;
+        }
+    }
+
+    return victim;
+}
+
+std::shared_ptr<ReplacementData>
+ListLRU::instantiateEntry()
+{
+    return std::shared_ptr<ReplacementData>(new ListLRUReplData());
+}
+
+} // namespace replacement_policy
+} // namespace gem5
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a list based Least Recently Used replacement policy.
+ * The victim is the entry at the tail of a most recently used first list.
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_LIST_LRU_RP_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_LIST_LRU_RP_HH__
+
+#include "mem/cache/replacement_policies/base.hh"
+#include "mem/cache/replacement_policies/recency_list.hh"
+
+namespace gem5
+{
+
+struct ListLRURPParams;
+
+namespace replacement_policy
+{
+
+/**
+ * LRU replacement behaving as a list of the entries, most recently used
+ * first: entries move to the head when they are inserted or touched, and
+ * the victim is the entry at the tail. Unlike LRU, the order is kept by
+ * access (so entries touched in the same tick don't tie) and invalidated
+ * entries keep their position. Touches of the entries in the first
+ * mru_range + 1 positions don't reorder the list.
+ *
+ * The order is kept across all the entries using the policy, which makes
+ * it exact for fully associative structures.
+ */
+class ListLRU : public Base
+{
+  protected:
+    /** ListLRU-specific implementation of replacement data. */
+    struct ListLRUReplData : ReplacementData
+    {
+        /** Position in the list, see RecencyList. */
+        uint64_t stamp;
+
+        /**
+         * Default constructor. Places the entry at the tail.
+         */
+        ListLRUReplData() : stamp(0) {}
+    };
+
+    /** Order of the entries, updated by the const touch and reset. */
+    mutable RecencyList order;
+
+  public:
+    typedef ListLRURPParams Params;
+    ListLRU(const Params &p);
+    ~ListLRU() = default;
+
+    /**
+     * Invalidate replacement data. The entry keeps its position in the
+     * list.
+     *
+     * @param replacement_data Replacement data to be invalidated.
+     */
+    void invalidate(const std::shared_ptr<ReplacementData>& replacement_data)
+                                                                    override;
+
+    /**
+     * Touch an entry to update its replacement data.
+     * Moves it to the head of the list, unless it is close to it.
+     *
+     * @param replacement_data Replacement data to be touched.
+     */
+    void touch(const std::shared_ptr<ReplacementData>& replacement_data) const
+                                                                     override;
+
+    /**
+     * Reset replacement data. Used when an entry is inserted.
+     * Moves it to the head of the list.
+     *
+     * @param replacement_data Replacement data to be reset.
+     */
+    void reset(const std::shared_ptr<ReplacementData>& replacement_data) const
+                                                                     override;
+
+    /**
+     * Find replacement victim, the candidate closest to the tail.
+     *
+     * @param candidates Replacement candidates, selected by indexing policy.
+     * @return Replacement entry to be replaced.
+     */
+    ReplaceableEntry* getVictim(const ReplacementCandidates& candidates) const
+                                                                     override;
+
+    /**
+     * Instantiate a replacement data entry.
+     *
+     * @return A shared pointer to the new replacement data.
+     */
+    std::shared_ptr<ReplacementData> instantiateEntry() override;
+};
+
+} // namespace replacement_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_LIST_LRU_RP_HH__
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Stamps keeping a set of entries in a most recently used first list.
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_RECENCY_LIST_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_RECENCY_LIST_HH__
+
+#include <cstdint>
+
+namespace gem5
+{
+
+namespace replacement_policy
+{
+
+/**
+ * Keeps entries ordered as in a list where the most recently used entry
+ * is at the head, without moving them around. Every entry moved to the
+ * head gets a new, strictly increasing, stamp, so the list order is the
+ * decreasing stamp order and its tail is the entry with the smallest
+ * stamp. Stamps never tie, unlike tick based timestamps.
+ *
+ * Touching one of the first mruRange + 1 entries of the list doesn't
+ * move it. As such entries never move, the entries in these positions
+ * always hold the latest stamps, which lets a touch find out whether
+ * the entry is one of them without looking at the others.
+ */
+class RecencyList
+{
+  public:
+    RecencyList(unsigned mru_range=0) : mruRange(mru_range) {}
+
+    /** @return The stamp of an entry moved to the head of the list */
+    uint64_t moveToHead() { return ++lastStamp; }
+
+    /**
+     * @param stamp Current stamp of a touched entry
+     * @return Its new stamp, unchanged if it was close enough to the head
+     */
+    uint64_t
+    touch(uint64_t stamp)
+    {
+        return stamp + mruRange >= lastStamp ? stamp : moveToHead();
+    }
+
+    /** The stamp of the entry at the head of the list */
+    uint64_t last() const { return lastStamp; }
+
+    /** Restore the stamp of the entry at the head, e.g. from a checkpoint */
+    void setLast(uint64_t stamp) { lastStamp = stamp; }
+
+  private:
+    /** Number of entries after the head which aren't moved by touches */
+    const unsigned mruRange;
+    uint64_t lastStamp = 0;
+};
+
+} // namespace replacement_policy
+} // namespace gem5
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_RECENCY_LIST_HH__
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+#include "mem/cache/replacement_policies/recency_list.hh"
+
+using namespace gem5;
+using namespace gem5::replacement_policy;
+
+namespace
+{
+
+/**
+ * Reference model: the entries are kept in an actual list, most recently
+ * used first, as in a fully associative TLB which moves its entries
+ * around.
+ */
+class ListModel
+{
+  public:
+    ListModel(unsigned ways, unsigned mru_range)
+      : mruRange(mru_range)
+    {
+        // Ways that were never used are taken from the last one
+        for (unsigned way = ways; way > 0; way--)
+            list.push_back(way - 1);
+    }
+
+    void
+    touch(unsigned way)
+    {
+        auto it = std::find(list.begin(), list.end(), way);
+        if (it - list.begin() > mruRange) {
+            list.erase(it);
+            list.insert(list.begin(), way);
+        }
+    }
+
+    unsigned
+    insert()
+    {
+        unsigned victim = list.back();
+        list.pop_back();
+        list.insert(list.begin(), victim);
+        return victim;
+    }
+
+    const std::vector<unsigned> &order() const { return list; }
+
+  private:
+    const long mruRange;
+    std::vector<unsigned> list;
+};
+
+/** The same entries, ordered by stamps */
+class StampModel
+{
+  public:
+    StampModel(unsigned ways, unsigned mru_range)
+      : stamps(ways, 0), recency(mru_range)
+    {}
+
+    void
+    touch(unsigned way)
+    {
+        stamps[way] = recency.touch(stamps[way]);
+    }
+
+    unsigned
+    insert()
+    {
+        unsigned victim = std::min_element(stamps.begin(), stamps.end()) -
+            stamps.begin();
+        stamps[victim] = recency.moveToHead();
+        return victim;
+    }
+
+    std::vector<unsigned>
+    order() const
+    {
+        std::vector<unsigned> ways(stamps.size());
+        for (unsigned way = 0; way < ways.size(); way++)
+            ways[way] = way;
+        // Ways that were never used tie, the first one is the victim
+        std::sort(ways.begin(), ways.end(), [this](unsigned a, unsigned b) {
+            return stamps[a] != stamps[b] ? stamps[a] > stamps[b] : a > b;
+        });
+        return ways;
+    }
+
+  private:
+    std::vector<uint64_t> stamps;
+    RecencyList recency;
+};
+
+void
+compareModels(unsigned ways, unsigned mru_range, unsigned seed)
+{
+    ListModel list(ways, mru_range);
+    StampModel stamps(ways, mru_range);
+    std::vector<bool> valid(ways, false);
+
+    std::mt19937 rng(seed);
+    for (int step = 0; step < 10000; step++) {
+        unsigned way = rng() % ways;
+        switch (rng() % 4) {
+          case 0:
+            {
+                unsigned victim = list.insert();
+                ASSERT_EQ(victim, stamps.insert()) << "step " << step;
+                valid[victim] = true;
+            }
+            break;
+          case 1:
+            // Invalidations leave holes in the list
+            valid[way] = false;
+            break;
+          default:
+            if (valid[way]) {
+                list.touch(way);
+                stamps.touch(way);
+            }
+            break;
+        }
+        ASSERT_EQ(list.order(), stamps.order()) << "step " << step;
+    }
+}
+
+} // anonymous namespace
+
+TEST(RecencyListTest, MoveToHead)
+{
+    RecencyList recency;
+    EXPECT_EQ(1, recency.moveToHead());
+    EXPECT_EQ(2, recency.moveToHead());
+    EXPECT_EQ(2, recency.last());
+
+    recency.setLast(10);
+    EXPECT_EQ(11, recency.moveToHead());
+}
+
+TEST(RecencyListTest, MRURange)
+{
+    RecencyList recency(1);
+    uint64_t a = recency.moveToHead();
+    uint64_t b = recency.moveToHead();
+    uint64_t c = recency.moveToHead();
+
+    // The two most recently used entries don't move
+    EXPECT_EQ(c, recency.touch(c));
+    EXPECT_EQ(b, recency.touch(b));
+    // The third one does
+    uint64_t a2 = recency.touch(a);
+    EXPECT_GT(a2, c);
+    // Which makes the former head the second entry, and pushes the
+    // second one out of the range
+    EXPECT_EQ(c, recency.touch(c));
+    EXPECT_GT(recency.touch(b), a2);
+}
+
+TEST(RecencyListTest, SameAsListLRU)
+{
+    compareModels(8, 0, 1);
+    compareModels(64, 0, 2);
+}
+
+TEST(RecencyListTest, SameAsListWithMRURange)
+{
+    compareModels(8, 1, 3);
+    compareModels(64, 1, 4);
+    compareModels(16, 3, 5);
+}
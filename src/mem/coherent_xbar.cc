@@ -1001,6 +1001,15 @@ void
 CoherentXBar::recvMemBackdoorReq(const MemBackdoorReq &req,
         MemBackdoorPtr &backdoor)
 {
+    // Accesses through a back door aren't snooped, so don't grant one
+    // if caches above this crossbar may hold dirty copies of the data,
+    // which functional accesses would have observed.
+    if (!snoopPorts.empty() && !system->bypassCaches()) {
+        DPRINTF(CoherentXBar, "%s: refusing back door to %s, snooped\n",
+                __func__, req.range().to_string());
+        return;
+    }
+
     PortID dest_id = findPort(req.range());
     memSidePorts[dest_id]->sendMemBackdoorReq(req, backdoor);
 }
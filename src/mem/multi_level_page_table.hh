@@ -34,6 +34,7 @@
 #ifndef __MEM_MULTI_LEVEL_PAGE_TABLE_HH__
 #define __MEM_MULTI_LEVEL_PAGE_TABLE_HH__
 
+#include <mutex>
 #include <string>
 
 #include "base/types.hh"
@@ -197,6 +198,12 @@ class MultiLevelPageTable : public EmulationPageTable
      */
     Addr _basePtr;
 
+    /**
+     * Serializes the updates of the table in memory, which allocate
+     * its intermediate levels.
+     */
+    std::mutex walkMutex;
+
 public:
     MultiLevelPageTable(const std::string &__name, uint64_t _pid,
                         System *_sys, Addr _pageSize) :
@@ -221,6 +228,7 @@ public:
     {
         EmulationPageTable::map(vaddr, paddr, size, flags);
 
+        std::lock_guard<std::mutex> lock(walkMutex);
         Final entry;
 
         for (int64_t offset = 0; offset < size; offset += _pageSize) {
@@ -241,6 +249,7 @@ public:
     {
         EmulationPageTable::remap(vaddr, size, new_vaddr);
 
+        std::lock_guard<std::mutex> lock(walkMutex);
         Final old_entry, new_entry;
 
         for (int64_t offset = 0; offset < size; offset += _pageSize) {
@@ -264,6 +273,7 @@ public:
     {
         EmulationPageTable::unmap(vaddr, size);
 
+        std::lock_guard<std::mutex> lock(walkMutex);
         Final entry;
 
         for (int64_t offset = 0; offset < size; offset += _pageSize) {
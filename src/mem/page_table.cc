@@ -33,6 +33,7 @@
  */
 #include "mem/page_table.hh"
 
+#include <mutex>
 #include <string>
 
 #include "base/compiler.hh"
@@ -47,6 +48,7 @@ namespace gem5
 void
 EmulationPageTable::map(Addr vaddr, Addr paddr, int64_t size, uint64_t flags)
 {
+    std::unique_lock<std::shared_mutex> lock(mutex);
     bool clobber = flags & Clobber;
     // starting address must be page aligned
     assert(pageOffset(vaddr) == 0);
@@ -74,6 +76,7 @@ EmulationPageTable::map(Addr vaddr, Addr paddr, int64_t size, uint64_t flags)
 void
 EmulationPageTable::remap(Addr vaddr, int64_t size, Addr new_vaddr)
 {
+    std::unique_lock<std::shared_mutex> lock(mutex);
     assert(pageOffset(vaddr) == 0);
     assert(pageOffset(new_vaddr) == 0);
 
@@ -96,6 +99,7 @@ EmulationPageTable::remap(Addr vaddr, int64_t size, Addr new_vaddr)
 void
 EmulationPageTable::getMappings(std::vector<std::pair<Addr, Addr>> *addr_maps)
 {
+    std::shared_lock<std::shared_mutex> lock(mutex);
     for (auto &iter : pTable)
         addr_maps->push_back(std::make_pair(iter.first, iter.second.paddr));
 }
@@ -103,6 +107,7 @@ EmulationPageTable::getMappings(std::vector<std::pair<Addr, Addr>> *addr_maps)
 void
 EmulationPageTable::unmap(Addr vaddr, int64_t size)
 {
+    std::unique_lock<std::shared_mutex> lock(mutex);
     assert(pageOffset(vaddr) == 0);
 
     DPRINTF(MMU, "Unmapping page: %#x-%#x\n", vaddr, vaddr + size);
@@ -119,6 +124,7 @@ EmulationPageTable::unmap(Addr vaddr, int64_t size)
 bool
 EmulationPageTable::isUnmapped(Addr vaddr, int64_t size)
 {
+    std::shared_lock<std::shared_mutex> lock(mutex);
     // starting address must be page aligned
     assert(pageOffset(vaddr) == 0);
 
@@ -129,20 +135,21 @@ EmulationPageTable::isUnmapped(Addr vaddr, int64_t size)
     return true;
 }
 
-const EmulationPageTable::Entry *
+std::optional<EmulationPageTable::Entry>
 EmulationPageTable::lookup(Addr vaddr)
 {
+    std::shared_lock<std::shared_mutex> lock(mutex);
     Addr page_addr = pageAlign(vaddr);
     PTableItr iter = pTable.find(page_addr);
     if (iter == pTable.end())
-        return nullptr;
-    return &(iter->second);
+        return std::nullopt;
+    return iter->second;
 }
 
 bool
 EmulationPageTable::translate(Addr vaddr, Addr &paddr)
 {
-    const Entry *entry = lookup(vaddr);
+    auto entry = lookup(vaddr);
     if (!entry) {
         DPRINTF(MMU, "Couldn't Translate: %#x\n", vaddr);
         return false;
@@ -185,6 +192,7 @@ EmulationPageTable::PageTableTranslationGen::translate(Range &range) const
 void
 EmulationPageTable::serialize(CheckpointOut &cp) const
 {
+    std::shared_lock<std::shared_mutex> lock(mutex);
     ScopedCheckpointSection sec(cp, "ptable");
     paramOut(cp, "size", pTable.size());
 
@@ -202,6 +210,7 @@ EmulationPageTable::serialize(CheckpointOut &cp) const
 void
 EmulationPageTable::unserialize(CheckpointIn &cp)
 {
+    std::unique_lock<std::shared_mutex> lock(mutex);
     int count;
     ScopedCheckpointSection sec(cp, "ptable");
     paramIn(cp, "size", count);
@@ -223,6 +232,7 @@ EmulationPageTable::unserialize(CheckpointIn &cp)
 const std::string
 EmulationPageTable::externalize() const
 {
+    std::shared_lock<std::shared_mutex> lock(mutex);
     std::stringstream ss;
     for (PTable::const_iterator it=pTable.begin(); it != pTable.end(); ++it) {
         ss << std::hex << it->first << ":" << it->second.paddr << ";";
@@ -35,6 +35,8 @@
 #ifndef __MEM_PAGE_TABLE_HH__
 #define __MEM_PAGE_TABLE_HH__
 
+#include <optional>
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 
@@ -67,6 +69,13 @@ class EmulationPageTable : public Serializable
     typedef PTable::iterator PTableItr;
     PTable pTable;
 
+    /**
+     * The table is shared by the threads of a process, which may run on
+     * different event queues, so lookups return copies of the entries
+     * which stay valid when the table is updated.
+     */
+    mutable std::shared_mutex mutex;
+
     const Addr _pageSize;
     const Addr offsetMask;
 
@@ -137,9 +146,10 @@ class EmulationPageTable : public Serializable
     /**
      * Lookup function
      * @param vaddr The virtual address.
-     * @return The page table entry corresponding to vaddr.
+     * @return A copy of the page table entry corresponding to vaddr, if
+     *         it is mapped.
      */
-    const Entry *lookup(Addr vaddr);
+    std::optional<Entry> lookup(Addr vaddr);
 
     /**
      * Translate function
@@ -46,7 +46,10 @@ namespace gem5
 
 PortProxy::PortProxy(ThreadContext *tc, Addr cache_line_size) :
     PortProxy([tc](PacketPtr pkt)->void { tc->sendFunctional(pkt); },
-        cache_line_size)
+        cache_line_size,
+        [tc](const MemBackdoorReq &req, MemBackdoorPtr &backdoor)->void {
+            tc->sendMemBackdoorReq(req, backdoor);
+        })
 {}
 
 PortProxy::PortProxy(const RequestPort &port, Addr cache_line_size) :
@@ -88,6 +91,31 @@ PortProxy::writeBlobPhys(Addr addr, Request::Flags flags,
     }
 }
 
+uint8_t *
+PortProxy::hostPtrPhys(Addr addr, uint64_t size, bool write,
+                       MemBackdoorPtr &backdoor) const
+{
+    const AddrRange range = RangeSize(addr, size);
+    auto usable = [&](const MemBackdoorPtr bd) {
+        return bd && range.isSubset(bd->range()) &&
+            (write ? bd->writeable() : bd->readable());
+    };
+
+    if (!usable(backdoor)) {
+        if (!sendMemBackdoorReq)
+            return nullptr;
+        MemBackdoorPtr new_backdoor = nullptr;
+        sendMemBackdoorReq(MemBackdoorReq(range, write ?
+                    MemBackdoor::Writeable : MemBackdoor::Readable),
+                new_backdoor);
+        if (!usable(new_backdoor))
+            return nullptr;
+        backdoor = new_backdoor;
+    }
+
+    return backdoor->ptr() + (addr - backdoor->range().start());
+}
+
 void
 PortProxy::memsetBlobPhys(Addr addr, Request::Flags flags,
                           uint8_t v, uint64_t size) const
@@ -60,6 +60,7 @@
 #include <functional>
 #include <limits>
 
+#include "mem/backdoor.hh"
 #include "mem/protocol/functional.hh"
 #include "sim/byteswap.hh"
 
@@ -87,9 +88,14 @@ class PortProxy : FunctionalRequestProtocol
 {
   public:
     typedef std::function<void(PacketPtr pkt)> SendFunctionalFunc;
+    typedef std::function<void(const MemBackdoorReq &req,
+                               MemBackdoorPtr &backdoor)>
+        SendMemBackdoorReqFunc;
 
   private:
     SendFunctionalFunc sendFunctional;
+    /** Optional, to access memory directly through back doors. */
+    SendMemBackdoorReqFunc sendMemBackdoorReq;
 
     /** Granularity of any transactions issued through this proxy. */
     const Addr _cacheLineSize;
@@ -103,8 +109,10 @@ class PortProxy : FunctionalRequestProtocol
     }
 
   public:
-    PortProxy(SendFunctionalFunc func, Addr cache_line_size) :
-        sendFunctional(func), _cacheLineSize(cache_line_size)
+    PortProxy(SendFunctionalFunc func, Addr cache_line_size,
+              SendMemBackdoorReqFunc backdoor_func=nullptr) :
+        sendFunctional(func), sendMemBackdoorReq(backdoor_func),
+        _cacheLineSize(cache_line_size)
     {}
 
     // Helpers which create typical SendFunctionalFunc-s from other objects.
@@ -134,6 +142,21 @@ class PortProxy : FunctionalRequestProtocol
     void memsetBlobPhys(Addr addr, Request::Flags flags,
                         uint8_t v, uint64_t size) const;
 
+    /**
+     * Get a host pointer to size bytes of memory at physical address,
+     * through a memory back door. Back doors are only granted when
+     * nothing on the way to the memory, e.g. a cache, needs to see the
+     * accesses, so accessing memory through them is equivalent to, and
+     * much faster than, functional accesses.
+     *
+     * @param write Whether the memory will be written to.
+     * @param backdoor A back door from a previous call, which is used if
+     *                 it covers the range, and updated otherwise.
+     * @return The host pointer, nullptr if there is no back door.
+     */
+    uint8_t *hostPtrPhys(Addr addr, uint64_t size, bool write,
+                         MemBackdoorPtr &backdoor) const;
+
 
 
     /** Methods to override in base classes */
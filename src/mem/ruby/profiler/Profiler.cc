@@ -414,6 +414,8 @@ Profiler::collateStats()
         }
     }
 
+    // The sequencers only collect the breakdowns their stat level allows
+    const RubyStatLevel stat_level = m_ruby_system->getStatLevel();
     for (uint32_t i = 0; i < MachineType_NUM; i++) {
         for (std::map<uint32_t, AbstractController*>::iterator it =
                 m_ruby_system->m_abstract_controls[i].begin();
@@ -429,7 +431,8 @@ Profiler::collateStats()
                         m_hitLatencyHistSeqr.add(seq->getHitLatencyHist());
                 rubyProfilerStats.
                         m_missLatencyHistSeqr.add(seq->getMissLatencyHist());
-
+            }
+            if (seq != NULL && stat_level >= RubyStatLevel::aggregated) {
                 // add the per request type latencies
                 for (uint32_t j = 0; j < RubyRequestType_NUM; ++j) {
                     rubyProfilerStats
@@ -456,7 +459,10 @@ Profiler::collateStats()
                         .perMachineTypeStats
                         .m_missMachLatencyHistSeqr[j]
                         ->add(seq->getMissMachLatencyHist(j));
-
+                }
+            }
+            if (seq != NULL && stat_level == RubyStatLevel::full) {
+                for (uint32_t j = 0; j < MachineType_NUM; ++j) {
                     rubyProfilerStats
                         .perMachineTypeStats
                         .m_IssueToInitialDelayHistSeqr[j]
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_STRUCTURES_REQUESTFIFOTABLE_HH__
+#define __MEM_RUBY_STRUCTURES_REQUESTFIFOTABLE_HH__
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+#include "base/intmath.hh"
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+// Outstanding requests, kept in a FIFO per key (e.g. a line address or
+// an unaddressed transaction ID). Keys are looked up in an open-addressed
+// table sized by the expected number of requests, and the FIFOs are
+// chained through a pool of request slots that are reused once their
+// request completes. The table grows if more requests are inserted.
+// Slots never move, so a request stays valid while new ones are
+// inserted, even for the same key.
+template <class Request>
+class RequestFifoTable
+{
+  public:
+    RequestFifoTable(int capacity)
+        : numLines(0), freeSlot(-1), _size(0)
+    {
+        lines.resize(1 << ceilLog2(std::max(2 * capacity, 2)));
+    }
+
+    // Append a request to the FIFO of key. Returns true if the FIFO
+    // already held requests, i.e. the new request aliases them.
+    bool
+    insert(Addr key, const Request &req)
+    {
+        int slot = freeSlot;
+        if (slot >= 0) {
+            freeSlot = slots[slot].next;
+            slots[slot].req = req;
+        } else {
+            slot = slots.size();
+            slots.push_back(Slot{req, -1});
+        }
+        slots[slot].next = -1;
+        _size++;
+
+        int idx = findLine(key);
+        if (idx >= 0) {
+            Line &line = lines[idx];
+            slots[line.tail].next = slot;
+            line.tail = slot;
+            line.count++;
+            return true;
+        }
+
+        if (2 * (numLines + 1) > (int)lines.size())
+            grow();
+
+        const int mask = lines.size() - 1;
+        idx = bucket(key);
+        while (lines[idx].count > 0)
+            idx = (idx + 1) & mask;
+        lines[idx] = Line{key, slot, slot, 1};
+        numLines++;
+        return false;
+    }
+
+    // The oldest request of key, or nullptr if there are none
+    Request *
+    front(Addr key)
+    {
+        int idx = findLine(key);
+        return idx >= 0 ? &slots[lines[idx].head].req : nullptr;
+    }
+
+    void
+    popFront(Addr key)
+    {
+        int idx = findLine(key);
+        assert(idx >= 0);
+
+        Line &line = lines[idx];
+        int slot = line.head;
+        line.head = slots[slot].next;
+        slots[slot].next = freeSlot;
+        freeSlot = slot;
+        _size--;
+
+        if (--line.count == 0)
+            eraseLine(idx);
+    }
+
+    bool contains(Addr key) const { return findLine(key) >= 0; }
+
+    int
+    numRequests(Addr key) const
+    {
+        int idx = findLine(key);
+        return idx >= 0 ? lines[idx].count : 0;
+    }
+
+    int size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    // Calls f(key, request) on every request, the requests of a key
+    // being visited consecutively and in FIFO order
+    template <typename F>
+    void
+    forEach(F f) const
+    {
+        for (const auto &line : lines) {
+            for (int i = line.head; i >= 0; i = slots[i].next)
+                f(line.key, slots[i].req);
+        }
+    }
+
+    // The bucket a key is first looked up in, out of numBuckets()
+    int
+    bucket(Addr key) const
+    {
+        // Line addresses share their low bits, so mix all of the key's
+        // bits into the ones that select the bucket
+        const int bits = floorLog2(lines.size());
+        return (key * 0x9e3779b97f4a7c15ULL) >> (64 - bits);
+    }
+
+    int numBuckets() const { return lines.size(); }
+
+  private:
+    struct Slot
+    {
+        Request req;
+        int next;
+    };
+
+    // A bucket of the open-addressed table, empty if it has no requests
+    struct Line
+    {
+        Addr key = 0;
+        int head = -1;
+        int tail = -1;
+        int count = 0;
+    };
+
+    int
+    findLine(Addr key) const
+    {
+        const int mask = lines.size() - 1;
+        for (int idx = bucket(key); lines[idx].count > 0;
+             idx = (idx + 1) & mask) {
+            if (lines[idx].key == key)
+                return idx;
+        }
+        return -1;
+    }
+
+    void
+    eraseLine(int idx)
+    {
+        // Shift the following lines of the probe sequence back, so that
+        // lookups never have to skip over deleted buckets
+        const int mask = lines.size() - 1;
+        int hole = idx;
+        for (int next = (idx + 1) & mask; lines[next].count > 0;
+             next = (next + 1) & mask) {
+            int home = bucket(lines[next].key);
+            if (((next - home) & mask) >= ((next - hole) & mask)) {
+                lines[hole] = lines[next];
+                hole = next;
+            }
+        }
+        lines[hole] = Line();
+        numLines--;
+    }
+
+    void
+    grow()
+    {
+        std::vector<Line> old_lines(lines.size() * 2);
+        old_lines.swap(lines);
+
+        const int mask = lines.size() - 1;
+        for (const auto &line : old_lines) {
+            if (line.count == 0)
+                continue;
+            int idx = bucket(line.key);
+            while (lines[idx].count > 0)
+                idx = (idx + 1) & mask;
+            lines[idx] = line;
+        }
+    }
+
+    // Power-of-two sized, linearly probed and at most half full
+    std::vector<Line> lines;
+    int numLines;
+
+    std::deque<Slot> slots;
+    int freeSlot;
+    int _size;
+};
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_STRUCTURES_REQUESTFIFOTABLE_HH__
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "mem/ruby/structures/RequestFifoTable.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+namespace
+{
+
+struct TestRequest
+{
+    int id;
+};
+
+typedef RequestFifoTable<TestRequest> TestTable;
+
+/** Line addresses, from start, whose first bucket in table is bucket */
+std::vector<Addr>
+keysInBucket(const TestTable &table, int bucket, int count, Addr start=0)
+{
+    std::vector<Addr> keys;
+    for (Addr key = start; (int)keys.size() < count; key += 64) {
+        if (table.bucket(key) == bucket)
+            keys.push_back(key);
+    }
+    return keys;
+}
+
+} // anonymous namespace
+
+TEST(RequestFifoTable, Empty)
+{
+    TestTable table(4);
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(0, table.size());
+    EXPECT_FALSE(table.contains(0x40));
+    EXPECT_EQ(nullptr, table.front(0x40));
+    EXPECT_EQ(0, table.numRequests(0x40));
+}
+
+TEST(RequestFifoTable, FifoPerKey)
+{
+    TestTable table(4);
+    EXPECT_FALSE(table.insert(0x40, {1}));
+    EXPECT_FALSE(table.insert(0x80, {2}));
+    EXPECT_TRUE(table.insert(0x40, {3}));
+    EXPECT_EQ(3, table.size());
+    EXPECT_EQ(2, table.numRequests(0x40));
+
+    EXPECT_EQ(1, table.front(0x40)->id);
+    table.popFront(0x40);
+    EXPECT_EQ(3, table.front(0x40)->id);
+    table.popFront(0x40);
+    EXPECT_FALSE(table.contains(0x40));
+    EXPECT_EQ(2, table.front(0x80)->id);
+    table.popFront(0x80);
+    EXPECT_TRUE(table.empty());
+}
+
+TEST(RequestFifoTable, RequestsDontMove)
+{
+    TestTable table(2);
+    table.insert(0x40, {1});
+    TestRequest *req = table.front(0x40);
+
+    // Grow the table and the slot pool
+    for (int i = 0; i < 100; i++)
+        table.insert(0x1000 + i * 64, {i});
+    table.insert(0x40, {2});
+
+    EXPECT_EQ(req, table.front(0x40));
+    EXPECT_EQ(1, req->id);
+}
+
+TEST(RequestFifoTable, WrapAround)
+{
+    TestTable table(4);
+    const int last = table.numBuckets() - 1;
+    const auto keys = keysInBucket(table, last, 3);
+
+    // The probe sequence of the last bucket wraps around to the first
+    // ones
+    for (int i = 0; i < 3; i++)
+        table.insert(keys[i], {i});
+    ASSERT_EQ(last + 1, table.numBuckets());
+
+    // Removing the head of the run shifts the wrapped lines back
+    table.popFront(keys[0]);
+    EXPECT_FALSE(table.contains(keys[0]));
+    for (int i = 1; i < 3; i++) {
+        ASSERT_TRUE(table.contains(keys[i]));
+        EXPECT_EQ(i, table.front(keys[i])->id);
+    }
+
+    table.insert(keys[0], {3});
+    EXPECT_EQ(3, table.front(keys[0])->id);
+    EXPECT_EQ(3, table.size());
+}
+
+TEST(RequestFifoTable, EraseInRun)
+{
+    TestTable table(4);
+    const int last = table.numBuckets() - 1;
+    // A run starting at the second to last bucket, wrapping around, and
+    // a key of the first bucket which is displaced by the run
+    const auto run = keysInBucket(table, last - 1, 3);
+    const auto first = keysInBucket(table, 0, 1);
+
+    for (int i = 0; i < 3; i++)
+        table.insert(run[i], {i});
+    table.insert(first[0], {3});
+    ASSERT_EQ(last + 1, table.numBuckets());
+
+    // Remove the line in the middle of the run
+    table.popFront(run[1]);
+    EXPECT_FALSE(table.contains(run[1]));
+    EXPECT_EQ(0, table.front(run[0])->id);
+    EXPECT_EQ(2, table.front(run[2])->id);
+    EXPECT_EQ(3, table.front(first[0])->id);
+
+    table.popFront(run[0]);
+    EXPECT_EQ(2, table.front(run[2])->id);
+    EXPECT_EQ(3, table.front(first[0])->id);
+    EXPECT_EQ(2, table.size());
+}
+
+TEST(RequestFifoTable, MatchesReference)
+{
+    std::mt19937 rng(1);
+    TestTable table(4);
+    std::map<Addr, std::deque<int>> ref;
+    int size = 0;
+
+    for (int i = 0; i < 100000; i++) {
+        // Few keys, so that lines are often erased and reinserted
+        const Addr key = (rng() % 24) * 64;
+        auto it = ref.find(key);
+        if (rng() % 2 && it != ref.end()) {
+            ASSERT_EQ(it->second.front(), table.front(key)->id);
+            table.popFront(key);
+            it->second.pop_front();
+            if (it->second.empty())
+                ref.erase(it);
+            size--;
+        } else {
+            ASSERT_EQ(it != ref.end(), table.insert(key, {i}));
+            ref[key].push_back(i);
+            size++;
+        }
+
+        ASSERT_EQ(size, table.size());
+        for (Addr k = 0; k < 24 * 64; k += 64) {
+            auto r = ref.find(k);
+            ASSERT_EQ(r != ref.end(), table.contains(k));
+            ASSERT_EQ(r == ref.end() ? 0 : (int)r->second.size(),
+                      table.numRequests(k));
+        }
+    }
+
+    std::map<Addr, std::deque<int>> visited;
+    table.forEach([&](Addr key, const TestRequest &req) {
+        visited[key].push_back(req.id);
+    });
+    EXPECT_EQ(ref, visited);
+}
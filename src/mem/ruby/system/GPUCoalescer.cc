@@ -31,6 +31,8 @@
 
 #include "mem/ruby/system/GPUCoalescer.hh"
 
+#include <algorithm>
+
 #include "base/compiler.hh"
 #include "base/logging.hh"
 #include "base/str.hh"
@@ -59,82 +61,80 @@ namespace ruby
 {
 
 UncoalescedTable::UncoalescedTable(GPUCoalescer *gc)
-    : coalescer(gc)
+    : coalescer(gc), insts(16), numInsts(0)
 {
 }
 
-void
-UncoalescedTable::insertPacket(PacketPtr pkt)
+UncoalescedInst*
+UncoalescedTable::find(InstSeqNum seqNum)
 {
-    uint64_t seqNum = pkt->req->getReqInstSeqNum();
+    // packets are almost always for the youngest instruction, so search
+    // from the back
+    for (int i = numInsts - 1; i >= 0; --i) {
+        if (at(i).seqNum == seqNum) {
+            return &at(i);
+        }
+    }
 
-    instMap[seqNum].push_back(pkt);
-    DPRINTF(GPUCoalescer, "Adding 0x%X seqNum %d to map. (map %d vec %d)\n",
-            pkt->getAddr(), seqNum, instMap.size(), instMap[seqNum].size());
+    return nullptr;
 }
 
 void
-UncoalescedTable::insertReqType(PacketPtr pkt, RubyRequestType type)
+UncoalescedTable::insertPacket(PacketPtr pkt, RubyRequestType type,
+                               int num_packets)
 {
     uint64_t seqNum = pkt->req->getReqInstSeqNum();
 
-    reqTypeMap[seqNum] = type;
-}
+    UncoalescedInst *inst = find(seqNum);
+    if (!inst) {
+        if (numInsts == (int)insts.size()) {
+            insts.resize(insts.size() * 2);
+        }
 
-bool
-UncoalescedTable::packetAvailable()
-{
-    return !instMap.empty();
-}
+        // keep the entries in age order, the new instruction is normally
+        // the youngest
+        int pos = numInsts++;
+        while (pos > 0 && at(pos - 1).seqNum > seqNum) {
+            std::swap(at(pos), at(pos - 1));
+            --pos;
+        }
 
-void
-UncoalescedTable::initPacketsRemaining(InstSeqNum seqNum, int count)
-{
-    if (!instPktsRemaining.count(seqNum)) {
-        instPktsRemaining[seqNum] = count;
+        inst = &at(pos);
+        inst->seqNum = seqNum;
+        inst->pktsRemaining = num_packets;
+        inst->reqType = type;
+        inst->pkts.clear();
     }
-}
-
-int
-UncoalescedTable::getPacketsRemaining(InstSeqNum seqNum)
-{
-    return instPktsRemaining[seqNum];
-}
 
-void
-UncoalescedTable::setPacketsRemaining(InstSeqNum seqNum, int count)
-{
-    instPktsRemaining[seqNum] = count;
+    inst->pkts.push_back(pkt);
+    DPRINTF(GPUCoalescer, "Adding 0x%X seqNum %d to map. (map %d vec %d)\n",
+            pkt->getAddr(), seqNum, numInsts, inst->pkts.size());
 }
 
-PerInstPackets*
-UncoalescedTable::getInstPackets(int offset)
+UncoalescedInst*
+UncoalescedTable::getInst(int offset)
 {
-    if (offset >= instMap.size()) {
+    if (offset >= numInsts) {
         return nullptr;
     }
 
-    auto instMapIter = instMap.begin();
-    std::advance(instMapIter, offset);
-
-    return &(instMapIter->second);
+    return &at(offset);
 }
 
 void
 UncoalescedTable::updateResources()
 {
-    for (auto iter = instMap.begin(); iter != instMap.end(); ) {
-        InstSeqNum seq_num = iter->first;
+    // compact the remaining instructions towards the front, preserving
+    // their order
+    int kept = 0;
+    for (int i = 0; i < numInsts; ++i) {
+        UncoalescedInst &inst = at(i);
+        InstSeqNum seq_num = inst.seqNum;
         DPRINTF(GPUCoalescer, "%s checking remaining pkts for %d\n",
                 coalescer->name().c_str(), seq_num);
-        assert(instPktsRemaining.count(seq_num));
-
-        if (instPktsRemaining[seq_num] == 0) {
-            assert(iter->second.empty());
 
-            // Remove from both maps
-            instMap.erase(iter++);
-            instPktsRemaining.erase(seq_num);
+        if (inst.pktsRemaining == 0) {
+            assert(inst.pkts.empty());
 
             // Release the token if the Ruby system is not in cooldown
             // or warmup phases. When in these phases, the RubyPorts
@@ -143,41 +143,38 @@ UncoalescedTable::updateResources()
             // sending tokens through the port unnecessary
             if (!RubySystem::getWarmupEnabled()
                     && !RubySystem::getCooldownEnabled()) {
-                if (reqTypeMap[seq_num] != RubyRequestType_FLUSH) {
+                if (inst.reqType != RubyRequestType_FLUSH) {
                     DPRINTF(GPUCoalescer,
                             "Returning token seqNum %d\n", seq_num);
                     coalescer->getGMTokenPort().sendTokens(1);
                 }
             }
-
-            reqTypeMap.erase(seq_num);
         } else {
-            ++iter;
+            if (kept != i) {
+                std::swap(at(kept), inst);
+            }
+            ++kept;
         }
     }
+
+    numInsts = kept;
 }
 
 bool
 UncoalescedTable::areRequestsDone(const uint64_t instSeqNum) {
-    // iterate the instructions held in UncoalescedTable to see whether there
+    // search the instructions held in UncoalescedTable to see whether there
     // are more requests to issue; if yes, not yet done; otherwise, done
-    for (auto& inst : instMap) {
-        DPRINTF(GPUCoalescer, "instSeqNum= %d, pending packets=%d\n"
-            ,inst.first, inst.second.size());
-        if (inst.first == instSeqNum) { return false; }
-    }
-
-    return true;
+    return !find(instSeqNum);
 }
 
 void
 UncoalescedTable::printRequestTable(std::stringstream& ss)
 {
-    ss << "Listing pending packets from " << instMap.size() << " instructions";
+    ss << "Listing pending packets from " << numInsts << " instructions";
 
-    for (auto& inst : instMap) {
-        ss << "\tAddr: " << printAddress(inst.first) << " with "
-           << inst.second.size() << " pending packets" << std::endl;
+    for (int i = 0; i < numInsts; ++i) {
+        ss << "\tAddr: " << printAddress(at(i).seqNum) << " with "
+           << at(i).pkts.size() << " pending packets" << std::endl;
     }
 }
 
@@ -186,8 +183,8 @@ UncoalescedTable::checkDeadlock(Tick threshold)
 {
     Tick current_time = curTick();
 
-    for (auto &it : instMap) {
-        for (auto &pkt : it.second) {
+    for (int i = 0; i < numInsts; ++i) {
+        for (auto &pkt : at(i).pkts) {
             if (current_time - pkt->req->time() > threshold) {
                 std::stringstream ss;
                 printRequestTable(ss);
@@ -196,7 +193,7 @@ UncoalescedTable::checkDeadlock(Tick threshold)
                      "version: %d request.paddr: 0x%x uncoalescedTable: %d "
                      "current time: %u issue_time: %d difference: %d\n"
                      "Request Tables:\n\n%s", coalescer->getId(),
-                      pkt->getAddr(), instMap.size(), current_time,
+                      pkt->getAddr(), numInsts, current_time,
                       pkt->req->time(), current_time - pkt->req->time(),
                       ss.str());
             }
@@ -287,6 +284,9 @@ GPUCoalescer::GPUCoalescer(const Params &p)
 
 GPUCoalescer::~GPUCoalescer()
 {
+    for (auto crequest : freeCoalescedReqs) {
+        delete crequest;
+    }
 }
 
 Port &
@@ -441,7 +441,7 @@ GPUCoalescer::writeCallback(Addr address,
                 forwardRequestTime, firstResponseTime, isRegion);
 
     // remove this crequest in coalescedTable
-    delete crequest;
+    freeCoalescedRequest(crequest);
     coalescedTable.at(address).pop_front();
 
     if (coalescedTable.at(address).empty()) {
@@ -529,7 +529,7 @@ GPUCoalescer::readCallback(Addr address,
     hitCallback(crequest, mach, data, true, crequest->getIssueTime(),
                 forwardRequestTime, firstResponseTime, isRegion);
 
-    delete crequest;
+    freeCoalescedRequest(crequest);
     coalescedTable.at(address).pop_front();
     if (coalescedTable.at(address).empty()) {
       coalescedTable.erase(address);
@@ -566,7 +566,7 @@ GPUCoalescer::hitCallback(CoalescedRequest* crequest,
     // update the data
     //
     // MUST ADD DOING THIS FOR EACH REQUEST IN COALESCER
-    std::vector<PacketPtr> pktList = crequest->getPackets();
+    std::vector<PacketPtr>& pktList = crequest->getPackets();
 
     uint8_t* log = nullptr;
     DPRINTF(GPUCoalescer, "Responding to %d packets for addr 0x%X\n",
@@ -705,9 +705,7 @@ GPUCoalescer::makeRequest(PacketPtr pkt)
         // it's picked for coalescing process later in this cycle or in a
         // future cycle. Packets remaining is set to the number of excepted
         // requests from the instruction based on its exec_mask.
-        uncoalescedTable.insertPacket(pkt);
-        uncoalescedTable.insertReqType(pkt, getRequestType(pkt));
-        uncoalescedTable.initPacketsRemaining(seq_num, num_packets);
+        uncoalescedTable.insertPacket(pkt, getRequestType(pkt), num_packets);
         DPRINTF(GPUCoalescer, "Put pkt with addr 0x%X to uncoalescedTable\n",
                 pkt->getAddr());
 
@@ -785,7 +783,7 @@ GPUCoalescer::coalescePacket(PacketPtr pkt)
         DPRINTF(GPUCoalescer, "Creating new or aliased request for 0x%X\n",
                 line_addr);
 
-        CoalescedRequest *creq = new CoalescedRequest(seqNum);
+        CoalescedRequest *creq = allocCoalescedRequest(seqNum);
         creq->insertPacket(pkt);
         creq->setRubyType(getRequestType(pkt));
         creq->setIssueTime(curCycle());
@@ -853,27 +851,47 @@ GPUCoalescer::coalescePacket(PacketPtr pkt)
     return false;
 }
 
+CoalescedRequest*
+GPUCoalescer::allocCoalescedRequest(uint64_t seq_num)
+{
+    if (freeCoalescedReqs.empty()) {
+        return new CoalescedRequest(seq_num);
+    }
+
+    CoalescedRequest *crequest = freeCoalescedReqs.back();
+    freeCoalescedReqs.pop_back();
+    crequest->reset(seq_num);
+    return crequest;
+}
+
+void
+GPUCoalescer::freeCoalescedRequest(CoalescedRequest *crequest)
+{
+    freeCoalescedReqs.push_back(crequest);
+}
+
 void
 GPUCoalescer::completeIssue()
 {
     // Iterate over the maximum number of instructions we can coalesce
     // per cycle (coalescingWindow).
     for (int instIdx = 0; instIdx < coalescingWindow; ++instIdx) {
-        PerInstPackets *pkt_list =
-            uncoalescedTable.getInstPackets(instIdx);
+        UncoalescedInst *inst = uncoalescedTable.getInst(instIdx);
 
-        // getInstPackets will return nullptr if no instruction
+        // getInst will return nullptr if no instruction
         // exists at the current offset.
-        if (!pkt_list) {
+        if (!inst) {
             break;
-        } else if (pkt_list->empty()) {
+        }
+
+        PerInstPackets *pkt_list = &inst->pkts;
+        if (pkt_list->empty()) {
             // Found something, but it has not been cleaned up by update
             // resources yet. See if there is anything else to coalesce.
             // Assume we can't check anymore if the coalescing window is 1.
             continue;
         } else {
-            // All packets in the list have the same seqNum, use first.
-            InstSeqNum seq_num = pkt_list->front()->req->getReqInstSeqNum();
+            InstSeqNum seq_num = inst->seqNum;
 
             // The difference in list size before and after tells us the
             // number of packets which were coalesced.
@@ -883,9 +901,20 @@ GPUCoalescer::completeIssue()
             // erase them from the list if coalescing is successful and
             // leave them in the list otherwise. This aggressively attempts
             // to coalesce as many packets as possible from the current inst.
-            pkt_list->remove_if(
-                [&](PacketPtr pkt) { return coalescePacket(pkt); }
-            );
+            pkt_list->erase(std::remove_if(pkt_list->begin(), pkt_list->end(),
+                [&](PacketPtr pkt) { return coalescePacket(pkt); }),
+                pkt_list->end());
+
+            assert(pkt_list_size >= pkt_list->size());
+            size_t pkt_list_diff = pkt_list_size - pkt_list->size();
+
+            // Update the count before issuing, as issuing may add
+            // instructions to the table and move its entries.
+            inst->pktsRemaining -= pkt_list_diff;
+            assert(inst->pktsRemaining >= 0);
+            DPRINTF(GPUCoalescer,
+                    "Coalesced %d pkts for seqNum %d, %d remaining\n",
+                    pkt_list_diff, seq_num, inst->pktsRemaining);
 
             if (coalescedReqs.count(seq_num)) {
                 auto& creqs = coalescedReqs.at(seq_num);
@@ -897,18 +926,6 @@ GPUCoalescer::completeIssue()
                 }
                 coalescedReqs.erase(seq_num);
             }
-
-            assert(pkt_list_size >= pkt_list->size());
-            size_t pkt_list_diff = pkt_list_size - pkt_list->size();
-
-            int num_remaining = uncoalescedTable.getPacketsRemaining(seq_num);
-            num_remaining -= pkt_list_diff;
-            assert(num_remaining >= 0);
-
-            uncoalescedTable.setPacketsRemaining(seq_num, num_remaining);
-            DPRINTF(GPUCoalescer,
-                    "Coalesced %d pkts for seqNum %d, %d remaining\n",
-                    pkt_list_diff, seq_num, num_remaining);
         }
     }
 
@@ -958,7 +975,7 @@ GPUCoalescer::atomicCallback(Addr address,
     hitCallback(crequest, mach, (DataBlock&)data, true,
                 crequest->getIssueTime(), Cycles(0), Cycles(0), false);
 
-    delete crequest;
+    freeCoalescedRequest(crequest);
     coalescedTable.at(address).pop_front();
 
     if (coalescedTable.at(address).empty()) {
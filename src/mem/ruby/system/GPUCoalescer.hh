@@ -34,6 +34,7 @@
 
 #include <iostream>
 #include <unordered_map>
+#include <vector>
 
 #include "base/statistics.hh"
 #include "gpu-compute/gpu_dyn_inst.hh"
@@ -62,7 +63,17 @@ struct MachineID;
 class CacheMemory;
 
 // List of packets that belongs to a specific instruction.
-typedef std::list<PacketPtr> PerInstPackets;
+typedef std::vector<PacketPtr> PerInstPackets;
+
+// Uncoalesced state of a single instruction.
+struct UncoalescedInst
+{
+    InstSeqNum seqNum = 0;
+    // number of packets of the instruction that are yet to be coalesced
+    int pktsRemaining = 0;
+    RubyRequestType reqType = RubyRequestType_NULL;
+    PerInstPackets pkts;
+};
 
 class UncoalescedTable
 {
@@ -70,40 +81,38 @@ class UncoalescedTable
     UncoalescedTable(GPUCoalescer *gc);
     ~UncoalescedTable() {}
 
-    void insertPacket(PacketPtr pkt);
-    void insertReqType(PacketPtr pkt, RubyRequestType type);
-    bool packetAvailable();
+    // Add a packet to the entry of its instruction, creating the entry if
+    // the instruction has not been seen before. The request type and
+    // expected packet count are only set when the entry is created.
+    void insertPacket(PacketPtr pkt, RubyRequestType type, int num_packets);
+    bool packetAvailable() const { return numInsts > 0; }
     void printRequestTable(std::stringstream& ss);
 
-    // Modify packets remaining map. Init sets value iff the seqNum has not
-    // yet been seen before. get/set act as a regular getter/setter.
-    void initPacketsRemaining(InstSeqNum seqNum, int count);
-    int getPacketsRemaining(InstSeqNum seqNum);
-    void setPacketsRemaining(InstSeqNum seqNum, int count);
-
-    // Returns a pointer to the list of packets corresponding to an
-    // instruction in the instruction map or nullptr if there are no
-    // instructions at the offset.
-    PerInstPackets* getInstPackets(int offset);
+    // Returns the instruction at the given age offset (0 is the oldest) or
+    // nullptr if there are no instructions at the offset.
+    UncoalescedInst* getInst(int offset);
     void updateResources();
     bool areRequestsDone(const InstSeqNum instSeqNum);
 
-    // Check if a packet hasn't been removed from instMap in too long.
+    // Check if a packet hasn't been removed from the table in too long.
     // Panics if a deadlock is detected and returns nothing otherwise.
     void checkDeadlock(Tick threshold);
 
   private:
-    GPUCoalescer *coalescer;
+    UncoalescedInst& at(int offset) { return insts[offset]; }
 
-    // Maps an instructions unique sequence number to a queue of packets
-    // which need responses. This data structure assumes the sequence number
-    // is monotonically increasing (which is true for CU class) in order to
-    // issue packets in age order.
-    std::map<InstSeqNum, PerInstPackets> instMap;
+    UncoalescedInst* find(InstSeqNum seqNum);
 
-    std::map<InstSeqNum, int> instPktsRemaining;
+    GPUCoalescer *coalescer;
 
-    std::map<InstSeqNum, RubyRequestType> reqTypeMap;
+    // Instructions ordered by their unique sequence number, the first
+    // numInsts entries being in use. This data structure assumes the
+    // sequence number is monotonically increasing (which is true for CU
+    // class) in order to issue packets in age order. Entries are reused
+    // once an instruction leaves the table, so their packet vectors keep
+    // their capacity and steady-state operation does not allocate.
+    std::vector<UncoalescedInst> insts;
+    int numInsts;
 };
 
 class CoalescedRequest
@@ -115,6 +124,17 @@ class CoalescedRequest
     {}
     ~CoalescedRequest() {}
 
+    // Prepare a recycled request for a new instruction. The packet vector
+    // keeps its capacity.
+    void
+    reset(uint64_t _seqNum)
+    {
+        seqNum = _seqNum;
+        issueTime = Cycles(0);
+        rubyType = RubyRequestType_NULL;
+        pkts.clear();
+    }
+
     void insertPacket(PacketPtr pkt) { pkts.push_back(pkt); }
     void setSeqNum(uint64_t _seqNum) { seqNum = _seqNum; }
     void setIssueTime(Cycles _issueTime) { issueTime = _issueTime; }
@@ -441,6 +461,12 @@ class GPUCoalescer : public RubyPort
     // coalesced request
     std::unordered_map<uint64_t, std::deque<CoalescedRequest*>> coalescedReqs;
 
+    // Completed coalesced requests kept for reuse, so that creating a
+    // request does not allocate its object or packet vector.
+    std::vector<CoalescedRequest*> freeCoalescedReqs;
+    CoalescedRequest *allocCoalescedRequest(uint64_t seq_num);
+    void freeCoalescedRequest(CoalescedRequest *crequest);
+
     // a map btw an instruction sequence number and PendingWriteInst
     // this is used to do a final call back for each write when it is
     // completely done in the memory system
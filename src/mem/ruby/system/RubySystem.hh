@@ -39,6 +39,7 @@
 
 #include "base/callback.hh"
 #include "base/output.hh"
+#include "enums/RubyStatLevel.hh"
 #include "mem/packet.hh"
 #include "mem/ruby/profiler/Profiler.hh"
 #include "mem/ruby/slicc_interface/AbstractController.hh"
@@ -78,6 +79,7 @@ class RubySystem : public ClockedObject
     memory::SimpleMemory *getPhysMem() { return m_phys_mem; }
     Cycles getStartCycle() { return m_start_cycle; }
     bool getAccessBackingStore() { return m_access_backing_store; }
+    RubyStatLevel getStatLevel() const { return m_stat_level; }
 
     // Public Methods
     Profiler*
@@ -144,6 +146,7 @@ class RubySystem : public ClockedObject
     static bool m_cooldown_enabled;
     memory::SimpleMemory *m_phys_mem;
     const bool m_access_backing_store;
+    const RubyStatLevel m_stat_level;
 
     //std::vector<Network *> m_networks;
     std::vector<std::unique_ptr<Network>> m_networks;
@@ -30,6 +30,10 @@ from m5.params import *
 from m5.proxy import *
 
 
+class RubyStatLevel(ScopedEnum):
+    vals = ["basic", "aggregated", "full"]
+
+
 class RubySystem(ClockedObject):
     type = "RubySystem"
     cxx_header = "mem/ruby/system/RubySystem.hh"
@@ -59,6 +63,13 @@ class RubySystem(ClockedObject):
 
     # Profiler related configuration variables
     hot_lines = Param.Bool(False, "")
+    stat_level = Param.RubyStatLevel(
+        "full",
+        "Latency histograms collected by the sequencers: overall only "
+        "(basic), also per request and responding machine type "
+        "(aggregated), or also the per (request, machine) type and miss "
+        "latency breakdown histograms (full)",
+    )
     all_instructions = Param.Bool(False, "")
     num_of_sequencers = Param.Int("")
     number_of_virtual_networks = Param.Unsigned("")
@@ -67,8 +67,29 @@ namespace gem5
 namespace ruby
 {
 
+std::ostream &
+operator<<(std::ostream &out, const SequencerRequestTable &table)
+{
+    bool first = true;
+    Addr cur_key = 0;
+    table.forEach([&](Addr key, const SequencerRequest &seq_req) {
+        if (first || key != cur_key) {
+            out << "[ " << key << " =";
+            first = false;
+            cur_key = key;
+        }
+        out << " " << RubyRequestType_to_string(seq_req.m_second_type);
+    });
+    out << " ]";
+
+    return out;
+}
+
 Sequencer::Sequencer(const Params &p)
-    : RubyPort(p), m_IncompleteTimes(MachineType_NUM),
+    : RubyPort(p), m_RequestTable(p.max_outstanding_requests),
+      m_UnaddressedRequestTable(p.max_outstanding_requests),
+      m_statLevel(p.ruby_system->getStatLevel()),
+      m_IncompleteTimes(MachineType_NUM),
       deadlockCheckEvent([this]{ wakeup(); }, "Sequencer deadlock check")
 {
     m_outstanding_count = 0;
@@ -94,6 +115,10 @@ Sequencer::Sequencer(const Params &p)
     m_hitLatencyHist.init(10);
     m_missLatencyHist.init(10);
 
+    // The breakdowns are only allocated if the stat level collects them
+    if (m_statLevel < RubyStatLevel::aggregated)
+        return;
+
     for (int i = 0; i < RubyRequestType_NUM; i++) {
         m_typeLatencyHist.push_back(new statistics::Histogram());
         m_typeLatencyHist[i]->init(10);
@@ -111,7 +136,12 @@ Sequencer::Sequencer(const Params &p)
 
         m_missMachLatencyHist.push_back(new statistics::Histogram());
         m_missMachLatencyHist[i]->init(10);
+    }
 
+    if (m_statLevel < RubyStatLevel::full)
+        return;
+
+    for (int i = 0; i < MachineType_NUM; i++) {
         m_IssueToInitialDelayHist.push_back(new statistics::Histogram());
         m_IssueToInitialDelayHist[i]->init(10);
 
@@ -142,7 +172,6 @@ Sequencer::Sequencer(const Params &p)
             m_missTypeMachLatencyHist[i][j]->init(10);
         }
     }
-
 }
 
 Sequencer::~Sequencer()
@@ -232,21 +261,20 @@ Sequencer::wakeup()
     // Check across all outstanding requests
     [[maybe_unused]] int total_outstanding = 0;
 
-    for (const auto &table_entry : m_RequestTable) {
-        for (const auto &seq_req : table_entry.second) {
-            if (current_time - seq_req.issue_time < m_deadlock_threshold)
-                continue;
-
-            panic("Possible Deadlock detected. Aborting!\n version: %d "
-                  "request.paddr: 0x%x m_readRequestTable: %d current time: "
-                  "%u issue_time: %d difference: %d\n", m_version,
-                  seq_req.pkt->getAddr(), table_entry.second.size(),
-                  current_time * clockPeriod(), seq_req.issue_time
-                  * clockPeriod(), (current_time * clockPeriod())
-                  - (seq_req.issue_time * clockPeriod()));
-        }
-        total_outstanding += table_entry.second.size();
-    }
+    m_RequestTable.forEach([&](Addr line_addr,
+                               const SequencerRequest &seq_req) {
+        if (current_time - seq_req.issue_time < m_deadlock_threshold)
+            return;
+
+        panic("Possible Deadlock detected. Aborting!\n version: %d "
+              "request.paddr: 0x%x m_readRequestTable: %d current time: "
+              "%u issue_time: %d difference: %d\n", m_version,
+              seq_req.pkt->getAddr(), m_RequestTable.numRequests(line_addr),
+              current_time * clockPeriod(), seq_req.issue_time
+              * clockPeriod(), (current_time * clockPeriod())
+              - (seq_req.issue_time * clockPeriod()));
+    });
+    total_outstanding += m_RequestTable.size();
 
     assert(m_outstanding_count == total_outstanding);
 
@@ -261,12 +289,10 @@ Sequencer::functionalWrite(Packet *func_pkt)
 {
     int num_written = RubyPort::functionalWrite(func_pkt);
 
-    for (const auto &table_entry : m_RequestTable) {
-        for (const auto& seq_req : table_entry.second) {
-            if (seq_req.functionalWrite(func_pkt))
-                ++num_written;
-        }
-    }
+    m_RequestTable.forEach([&](Addr, const SequencerRequest &seq_req) {
+        if (seq_req.functionalWrite(func_pkt))
+            ++num_written;
+    });
 
     return num_written;
 }
@@ -277,10 +303,25 @@ void Sequencer::resetStats()
     m_latencyHist.reset();
     m_hitLatencyHist.reset();
     m_missLatencyHist.reset();
+
+    if (m_statLevel < RubyStatLevel::aggregated)
+        return;
+
     for (int i = 0; i < RubyRequestType_NUM; i++) {
         m_typeLatencyHist[i]->reset();
         m_hitTypeLatencyHist[i]->reset();
         m_missTypeLatencyHist[i]->reset();
+    }
+
+    for (int i = 0; i < MachineType_NUM; i++) {
+        m_missMachLatencyHist[i]->reset();
+        m_hitMachLatencyHist[i]->reset();
+    }
+
+    if (m_statLevel < RubyStatLevel::full)
+        return;
+
+    for (int i = 0; i < RubyRequestType_NUM; i++) {
         for (int j = 0; j < MachineType_NUM; j++) {
             m_hitTypeMachLatencyHist[i][j]->reset();
             m_missTypeMachLatencyHist[i][j]->reset();
@@ -288,9 +329,6 @@ void Sequencer::resetStats()
     }
 
     for (int i = 0; i < MachineType_NUM; i++) {
-        m_missMachLatencyHist[i]->reset();
-        m_hitMachLatencyHist[i]->reset();
-
         m_IssueToInitialDelayHist[i]->reset();
         m_InitialToForwardDelayHist[i]->reset();
         m_ForwardToFirstResponseDelayHist[i]->reset();
@@ -324,15 +362,13 @@ Sequencer::insertRequest(PacketPtr pkt, RubyRequestType primary_type,
             {
                 incrementUnaddressedTransactionCnt();
 
-                // returns pair<inserted element, was inserted>
-                [[maybe_unused]] auto insert_data = \
-                    m_UnaddressedRequestTable.emplace(
+                [[maybe_unused]] bool aliased =
+                    m_UnaddressedRequestTable.insert(
                         getCurrentUnaddressedTransactionID(),
                         SequencerRequest(
                             pkt, primary_type, secondary_type, curCycle()));
 
-                // if insert_data.second is false, wasn't inserted
-                assert(insert_data.second &&
+                assert(!aliased &&
                        "Another TLBI request with the same ID exists");
 
                 DPRINTF(RubySequencer, "Inserting TLBI request %016x\n",
@@ -350,13 +386,11 @@ Sequencer::insertRequest(PacketPtr pkt, RubyRequestType primary_type,
 
     Addr line_addr = makeLineAddress(pkt->getAddr());
     // Check if there is any outstanding request for the same cache line.
-    auto &seq_req_list = m_RequestTable[line_addr];
-    // Create a default entry
-    seq_req_list.emplace_back(pkt, primary_type,
-        secondary_type, curCycle());
+    bool aliased = m_RequestTable.insert(line_addr,
+        SequencerRequest(pkt, primary_type, secondary_type, curCycle()));
     m_outstanding_count++;
 
-    if (seq_req_list.size() > 1) {
+    if (aliased) {
         return RequestStatus_Aliased;
     }
 
@@ -399,14 +433,24 @@ Sequencer::recordMissLatency(SequencerRequest* srequest, bool llscSuccess,
              "", "", printAddress(srequest->pkt->getAddr()), total_lat);
 
     m_latencyHist.sample(total_lat);
+    if (isExternalHit)
+        m_missLatencyHist.sample(total_lat);
+    else
+        m_hitLatencyHist.sample(total_lat);
+
+    if (m_statLevel < RubyStatLevel::aggregated)
+        return;
+
     m_typeLatencyHist[type]->sample(total_lat);
 
     if (isExternalHit) {
-        m_missLatencyHist.sample(total_lat);
         m_missTypeLatencyHist[type]->sample(total_lat);
 
         if (respondingMach != MachineType_NUM) {
             m_missMachLatencyHist[respondingMach]->sample(total_lat);
+            if (m_statLevel < RubyStatLevel::full)
+                return;
+
             m_missTypeMachLatencyHist[type][respondingMach]->sample(total_lat);
 
             if ((issued_time <= initialRequestTime) &&
@@ -427,12 +471,14 @@ Sequencer::recordMissLatency(SequencerRequest* srequest, bool llscSuccess,
             }
         }
     } else {
-        m_hitLatencyHist.sample(total_lat);
         m_hitTypeLatencyHist[type]->sample(total_lat);
 
         if (respondingMach != MachineType_NUM) {
             m_hitMachLatencyHist[respondingMach]->sample(total_lat);
-            m_hitTypeMachLatencyHist[type][respondingMach]->sample(total_lat);
+            if (m_statLevel == RubyStatLevel::full) {
+                m_hitTypeMachLatencyHist[type][respondingMach]->sample(
+                    total_lat);
+            }
         }
     }
 }
@@ -457,15 +503,16 @@ Sequencer::writeCallback(Addr address, DataBlock& data,
     // to this cache line when response for the write comes back
     //
     assert(address == makeLineAddress(address));
-    assert(m_RequestTable.find(address) != m_RequestTable.end());
-    auto &seq_req_list = m_RequestTable[address];
+    assert(m_RequestTable.contains(address));
 
     // Perform hitCallback on every cpu request made to this cache block while
     // ruby request was outstanding. Since only 1 ruby request was made,
     // profile the ruby latency once.
     bool ruby_request = true;
-    while (!seq_req_list.empty()) {
-        SequencerRequest &seq_req = seq_req_list.front();
+    // Requests issued from the callbacks below are appended to the same
+    // FIFO, and are handled by this loop as well
+    while (SequencerRequest *front = m_RequestTable.front(address)) {
+        SequencerRequest &seq_req = *front;
         // Atomic Request may be executed remotly in the cache hierarchy
         bool atomic_req =
            ((seq_req.m_type == RubyRequestType_ATOMIC_RETURN) ||
@@ -539,12 +586,7 @@ Sequencer::writeCallback(Addr address, DataBlock& data,
                         initialRequestTime, forwardRequestTime,
                         firstResponseTime, !ruby_request);
         }
-        seq_req_list.pop_front();
-    }
-
-    // free all outstanding requests corresponding to this address
-    if (seq_req_list.empty()) {
-        m_RequestTable.erase(address);
+        m_RequestTable.popFront(address);
     }
 }
 
@@ -560,15 +602,14 @@ Sequencer::readCallback(Addr address, DataBlock& data,
     // or end of the corresponding list.
     //
     assert(address == makeLineAddress(address));
-    assert(m_RequestTable.find(address) != m_RequestTable.end());
-    auto &seq_req_list = m_RequestTable[address];
+    assert(m_RequestTable.contains(address));
 
     // Perform hitCallback on every cpu request made to this cache block while
     // ruby request was outstanding. Since only 1 ruby request was made,
     // profile the ruby latency once.
     bool ruby_request = true;
-    while (!seq_req_list.empty()) {
-        SequencerRequest &seq_req = seq_req_list.front();
+    while (SequencerRequest *front = m_RequestTable.front(address)) {
+        SequencerRequest &seq_req = *front;
         if (ruby_request) {
             assert((seq_req.m_type == RubyRequestType_LD) ||
                    (seq_req.m_type == RubyRequestType_Load_Linked) ||
@@ -591,12 +632,7 @@ Sequencer::readCallback(Addr address, DataBlock& data,
                     initialRequestTime, forwardRequestTime,
                     firstResponseTime, !ruby_request);
         ruby_request = false;
-        seq_req_list.pop_front();
-    }
-
-    // free all outstanding requests corresponding to this address
-    if (seq_req_list.empty()) {
-        m_RequestTable.erase(address);
+        m_RequestTable.popFront(address);
     }
 }
 
@@ -614,14 +650,13 @@ Sequencer::atomicCallback(Addr address, DataBlock& data,
     // (the opperation could be performed remotly)
     //
     assert(address == makeLineAddress(address));
-    assert(m_RequestTable.find(address) != m_RequestTable.end());
-    auto &seq_req_list = m_RequestTable[address];
+    assert(m_RequestTable.contains(address));
 
     // Perform hitCallback only on the first cpu request that
     // issued the ruby request
     bool ruby_request = true;
-    while (!seq_req_list.empty()) {
-        SequencerRequest &seq_req = seq_req_list.front();
+    while (SequencerRequest *front = m_RequestTable.front(address)) {
+        SequencerRequest &seq_req = *front;
 
         if (ruby_request) {
             // Check that the request was an atomic memory operation
@@ -647,12 +682,7 @@ Sequencer::atomicCallback(Addr address, DataBlock& data,
         hitCallback(&seq_req, data, true, mach, externalHit,
                     initialRequestTime, forwardRequestTime,
                     firstResponseTime, false);
-        seq_req_list.pop_front();
-    }
-
-    // free all outstanding requests corresponding to this address
-    if (seq_req_list.empty()) {
-        m_RequestTable.erase(address);
+        m_RequestTable.popFront(address);
     }
 }
 
@@ -789,12 +819,11 @@ Sequencer::unaddressedCallback(Addr unaddressedReqId,
         // These signal that a TLBI operation that this core initiated
         // of the respective type (TLBI or Sync) has finished.
 
-        assert(m_UnaddressedRequestTable.find(unaddressedReqId)
-               != m_UnaddressedRequestTable.end());
+        assert(m_UnaddressedRequestTable.contains(unaddressedReqId));
 
         {
             SequencerRequest &seq_req =
-                m_UnaddressedRequestTable.at(unaddressedReqId);
+                *m_UnaddressedRequestTable.front(unaddressedReqId);
             assert(seq_req.m_type == reqType);
 
             PacketPtr pkt = seq_req.pkt;
@@ -803,7 +832,7 @@ Sequencer::unaddressedCallback(Addr unaddressedReqId,
             testDrainComplete();
         }
 
-        m_UnaddressedRequestTable.erase(unaddressedReqId);
+        m_UnaddressedRequestTable.popFront(unaddressedReqId);
         break;
       }
       default:
@@ -1029,21 +1058,6 @@ Sequencer::issueRequest(PacketPtr pkt, RubyRequestType secondary_type)
     m_mandatory_q_ptr->enqueue(msg, clockEdge(), latency);
 }
 
-template <class KEY, class VALUE>
-std::ostream &
-operator<<(std::ostream &out, const std::unordered_map<KEY, VALUE> &map)
-{
-    for (const auto &table_entry : map) {
-        out << "[ " << table_entry.first << " =";
-        for (const auto &seq_req : table_entry.second) {
-            out << " " << RubyRequestType_to_string(seq_req.m_second_type);
-        }
-    }
-    out << " ]";
-
-    return out;
-}
-
 void
 Sequencer::print(std::ostream& out) const
 {
@@ -42,14 +42,15 @@
 #define __MEM_RUBY_SYSTEM_SEQUENCER_HH__
 
 #include <iostream>
-#include <list>
-#include <unordered_map>
+#include <vector>
 
+#include "enums/RubyStatLevel.hh"
 #include "mem/ruby/common/Address.hh"
 #include "mem/ruby/protocol/MachineType.hh"
 #include "mem/ruby/protocol/RubyRequestType.hh"
 #include "mem/ruby/protocol/SequencerRequestType.hh"
 #include "mem/ruby/structures/CacheMemory.hh"
+#include "mem/ruby/structures/RequestFifoTable.hh"
 #include "mem/ruby/system/RubyPort.hh"
 #include "params/RubySequencer.hh"
 
@@ -83,6 +84,12 @@ struct SequencerRequest
 
 std::ostream& operator<<(std::ostream& out, const SequencerRequest& obj);
 
+// Outstanding sequencer requests, per line address or unaddressed
+// transaction ID
+typedef RequestFifoTable<SequencerRequest> SequencerRequestTable;
+
+std::ostream& operator<<(std::ostream& out, const SequencerRequestTable& obj);
+
 class Sequencer : public RubyPort
 {
   public:
@@ -229,10 +236,10 @@ class Sequencer : public RubyPort
 
   protected:
     // RequestTable contains both read and write requests, handles aliasing
-    std::unordered_map<Addr, std::list<SequencerRequest>> m_RequestTable;
+    SequencerRequestTable m_RequestTable;
     // UnadressedRequestTable contains "unaddressed" requests,
     // guaranteed not to alias each other
-    std::unordered_map<uint64_t, SequencerRequest> m_UnaddressedRequestTable;
+    SequencerRequestTable m_UnaddressedRequestTable;
 
     Cycles m_deadlock_threshold;
 
@@ -262,6 +269,12 @@ class Sequencer : public RubyPort
 
     bool m_runningGarnetStandalone;
 
+    //! Which of the latency histograms below are allocated and sampled:
+    //! the overall ones only, also those per request and responding
+    //! machine type, or also the per (request, machine) type and miss
+    //! latency breakdown histograms.
+    const RubyStatLevel m_statLevel;
+
     //! Histogram for number of outstanding requests per cycle.
     statistics::Histogram m_outstandReqHist;
 
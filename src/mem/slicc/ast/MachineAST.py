@@ -26,6 +26,7 @@
 # OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 from slicc.ast.DeclAST import DeclAST
+from slicc.ast.InPortDeclAST import InPortDeclAST
 from slicc.symbols import (
     StateMachine,
     Type,
@@ -71,6 +72,14 @@ class MachineAST(DeclAST):
 
         self.symtab.newCurrentMachine(machine)
 
+        # Peeks may precede the in_ports sharing their buffer, so collect
+        # the message types of every in_port up front
+        for decl in self.decls.decls:
+            if isinstance(decl, InPortDeclAST):
+                machine.in_port_msg_types.setdefault(
+                    decl.var_expr.name, set()
+                ).add(decl.msg_type.ident)
+
         # Generate code for all the internal decls
         self.decls.generate()
 
@@ -71,8 +71,26 @@ class PeekStatementAST(StatementAST):
         # Declare the new "in_msg_ptr" variable
         mtid = msg_type.c_ident
         qcode = self.queue_name.var.code
-        code(
-            """
+
+        # When every in_port reading this buffer expects the peeked type,
+        # a specialized controller can skip the dynamic type check
+        buffer_name = self.queue_name.var.pairs["buffer_expr"].name
+        msg_types = self.symtab.state_machine.in_port_msg_types.get(
+            buffer_name
+        )
+        if self.slicc.specialize and msg_types == {msg_type.ident}:
+            code(
+                """
+{
+    // Declare message
+    [[maybe_unused]] const $mtid* in_msg_ptr;
+    in_msg_ptr = static_cast<const $mtid *>(($qcode).${{self.method}}());
+    assert(dynamic_cast<const $mtid *>(in_msg_ptr) != NULL);
+"""
+            )
+        else:
+            code(
+                """
 {
     // Declare message
     [[maybe_unused]] const $mtid* in_msg_ptr;
@@ -84,7 +102,7 @@ class PeekStatementAST(StatementAST):
         throw RejectException();
     }
 """
-        )
+            )
 
         if "block_on" in self.pairs:
             address_field = self.pairs["block_on"]
@@ -91,6 +91,16 @@ def main(args=None):
         action="store_true",
         help="print traceback on error",
     )
+    parser.add_option(
+        "--table-dispatch",
+        action="store_true",
+        help="generate table-driven transitions and in_port wakeup",
+    )
+    parser.add_option(
+        "--specialize",
+        action="store_true",
+        help="generate controllers specialized for their own types",
+    )
     parser.add_option("-q", "--quiet", help="don't print messages")
     opts, files = parser.parse_args(args=args)
 
@@ -118,6 +128,8 @@ def main(args=None):
         verbose=True,
         debug=opts.debug,
         traceback=opts.tb,
+        table_dispatch=opts.table_dispatch,
+        specialize=opts.specialize,
     )
 
     if opts.print_files:
@@ -54,11 +54,22 @@ from slicc.symbols import SymbolTable
 
 class SLICC(Grammar):
     def __init__(
-        self, filename, base_dir, verbose=False, traceback=False, **kwargs
+        self,
+        filename,
+        base_dir,
+        verbose=False,
+        traceback=False,
+        table_dispatch=False,
+        specialize=False,
+        **kwargs,
     ):
         self.protocol = None
         self.traceback = traceback
         self.verbose = verbose
+        # Generate table-driven transitions and in_port wakeup
+        self.table_dispatch = table_dispatch
+        # Generate controllers specialized for their own types
+        self.specialize = specialize
         self.symtab = SymbolTable(self)
         self.base_dir = base_dir
 
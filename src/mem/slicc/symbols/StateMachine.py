@@ -131,6 +131,10 @@ class StateMachine(Symbol):
         self.debug_flags.add("RubyGenerated")
         self.debug_flags.add("RubySlicc")
 
+        # Message types read by the in_ports of each in_port buffer, keyed
+        # by the buffer's name
+        self.in_port_msg_types = {}
+
     def __repr__(self):
         return f"[StateMachine: {self.ident}]"
 
@@ -309,6 +313,9 @@ class $py_ident(RubyController):
         code = self.symtab.codeFormatter()
         ident = self.ident
         c_ident = f"{self.ident}_Controller"
+        # Nothing derives from a generated controller, so a specialized one
+        # is final and its calls to AbstractController virtuals devirtualize
+        final = " final" if self.symtab.slicc.specialize else ""
 
         code(
             """
@@ -347,7 +354,7 @@ namespace ruby
 
 extern std::stringstream ${ident}_transitionComment;
 
-class $c_ident : public AbstractController
+class ${c_ident}${final} : public AbstractController
 {
   public:
     typedef ${c_ident}Params Params;
@@ -547,6 +554,7 @@ void unset_tbe(${{self.TBEType.c_ident}}*& m_tbe_ptr);
         code = self.symtab.codeFormatter()
         ident = self.ident
         c_ident = f"{self.ident}_Controller"
+        specialize = self.symtab.slicc.specialize
 
         # Unfortunately, clang compilers will throw a "call to function ...
         # that is neither visible in the template definition nor found by
@@ -590,9 +598,12 @@ void unset_tbe(${{self.TBEType.c_ident}}*& m_tbe_ptr);
 
         code(boolvec_include)
         code(base_include)
-        # We have to sort self.debug_flags in order to produce deterministic
+        debug_flags = set(self.debug_flags)
+        if specialize:
+            debug_flags.add("ProtocolTrace")
+        # We have to sort the debug flags in order to produce deterministic
         # output and avoid unnecessary rebuilds of the generated files.
-        for f in sorted(self.debug_flags):
+        for f in sorted(debug_flags):
             code('#include "debug/${{f}}.hh"')
         code(
             """
@@ -1393,6 +1404,11 @@ $c_ident::functionalReadBuffers(PacketPtr& pkt, WriteMask &mask)
 """
         )
 
+        if specialize:
+            # Keep the transitions in the same translation unit as the
+            # actions and functions they call, so those can be inlined
+            self.printCTransitions(code)
+
         code.write(path, f"{c_ident}.cc")
 
     def printCWakeup(self, path, includes):
@@ -1552,6 +1568,16 @@ ${ident}_Controller::wakeup()
         code = self.symtab.codeFormatter()
         ident = self.ident
 
+        if self.symtab.slicc.specialize:
+            code(
+                """
+// ${ident}: ${{self.short}}
+// The transitions are generated into ${ident}_Controller.cc
+"""
+            )
+            code.write(path, f"{self.ident}_Transitions.cc")
+            return
+
         code(
             """
 // ${ident}: ${{self.short}}
@@ -1568,6 +1594,18 @@ ${ident}_Controller::wakeup()
 #include "mem/ruby/protocol/Types.hh"
 #include "mem/ruby/system/RubySystem.hh"
 
+"""
+        )
+        self.printCTransitions(code)
+        code.write(path, f"{self.ident}_Transitions.cc")
+
+    def printCTransitions(self, code):
+        """Output doTransition and doTransitionWorker"""
+
+        ident = self.ident
+
+        code(
+            """
 #define HASH_FUN(state, event)  ((int(state)*${ident}_Event_NUM)+int(event))
 
 #define GET_TRANSITION_COMMENT() (${ident}_transitionComment.str())
@@ -1725,10 +1763,273 @@ ${ident}_Controller::doTransitionWorker(${ident}_Event event,
 {
     m_curTransitionEvent = event;
     m_curTransitionNextState = next_state;
-    switch(HASH_FUN(state, event)) {
 """
         )
 
+        if self.symtab.slicc.table_dispatch:
+            self.printCTransitionTable(code)
+        else:
+            self.printCTransitionSwitch(code)
+
+        code(
+            """
+}
+
+} // namespace ruby
+} // namespace gem5
+"""
+        )
+
+    def transitionChecks(self, trans):
+        """Return the sorted resource checks of a transition, and the
+        request types it records"""
+
+        ident = self.ident
+        case_sorter = []
+        res = trans.resources
+        for key, val in res.items():
+            val = f"""
+if (!{key.code}.areNSlotsAvailable({val}, clockEdge()))
+    return TransitionResult_ResourceStall;
+"""
+            case_sorter.append(val)
+
+        # Check all of the request_types for resource constraints
+        for request_type in trans.request_types:
+            val = """
+if (!checkResourceAvailable({}_RequestType_{}, addr)) {{
+    return TransitionResult_ResourceStall;
+}}
+""".format(
+                ident,
+                request_type.ident,
+            )
+            case_sorter.append(val)
+
+        # Emit the code sequences in a sorted order.  This makes the
+        # output deterministic (without this the output order can vary
+        # since Map's keys() on a vector of pointers is not deterministic
+        checks = sorted(case_sorter)
+
+        # Record access types for this transition
+        for request_type in trans.request_types:
+            checks.append(
+                f"recordRequestType({ident}_RequestType_"
+                f"{request_type.ident}, addr);"
+            )
+
+        return checks
+
+    def transitionStalls(self, trans):
+        for action in trans.actions:
+            if action.ident == "z_stall":
+                return True
+        return False
+
+    def actionArgs(self):
+        if self.TBEType != None and self.EntryType != None:
+            return "m_tbe_ptr, m_cache_entry_ptr, addr"
+        elif self.TBEType != None:
+            return "m_tbe_ptr, addr"
+        elif self.EntryType != None:
+            return "m_cache_entry_ptr, addr"
+        else:
+            return "addr"
+
+    def printCTransitionTable(self, code):
+        """Output the transition tables and the code walking them"""
+
+        ident = self.ident
+        states = list(self.states.keys())
+        events = list(self.events.keys())
+
+        # Transitions that behave identically share one table entry, which
+        # is identified by its next state, checks and actions. Entry 0
+        # marks invalid transitions.
+        entries = OrderedDict()
+        index = [0] * (len(states) * len(events))
+        has_wildcard = False
+        for trans in self.transitions:
+            if trans.state == trans.nextState:
+                next_state = "NextStateUnchanged"
+            elif trans.nextState.isWildcard():
+                next_state = "NextStateWildcard"
+                has_wildcard = True
+            else:
+                next_state = f"{ident}_State_{trans.nextState.ident}"
+
+            stall = self.transitionStalls(trans)
+            actions = () if stall else tuple(a.ident for a in trans.actions)
+            key = (
+                next_state,
+                tuple(self.transitionChecks(trans)),
+                stall,
+                actions,
+            )
+            if key not in entries:
+                entries[key] = len(entries) + 1
+
+            hash_val = states.index(trans.state.ident) * len(events) + (
+                events.index(trans.event.ident)
+            )
+            index[hash_val] = entries[key]
+
+        idx_type = "uint8_t" if len(entries) < 256 else "uint16_t"
+        assert len(entries) < 65536
+
+        params = []
+        if self.TBEType != None:
+            params.append(f"{self.TBEType.c_ident}*&")
+        if self.EntryType != None:
+            params.append(f"{self.EntryType.c_ident}*&")
+        params.append("Addr")
+        params = ", ".join(params)
+
+        code(
+            """
+
+    typedef void (${ident}_Controller::*Action)($params);
+
+    constexpr int NextStateUnchanged = -1;
+    [[maybe_unused]] constexpr int NextStateWildcard = -2;
+
+    struct Transition
+    {
+        // Next state, or one of the NextState constants above
+        int nextState;
+        bool stall;
+        // Range of the transition's actions in the actions table
+        int firstAction;
+        int numActions;
+    };
+
+    // Table entry of every (state, event) pair, indexed by HASH_FUN
+    static const $idx_type transitionIndex[] = {
+"""
+        )
+        code.indent()
+        code.indent()
+        for i in range(0, len(index), len(events)):
+            row = index[i : i + len(events)]
+            code(f"// {ident}_State_{states[i // len(events)]}")
+            for j in range(0, len(row), 16):
+                code(", ".join(str(x) for x in row[j : j + 16]) + ",")
+        code.dedent()
+        code("};")
+        code()
+
+        code("static const Action actions[] = {")
+        code.indent()
+        code("nullptr,")
+        action_offsets = {}
+        offset = 1
+        for key in entries:
+            action_offsets[key] = offset
+            for action in key[3]:
+                code(f"&{ident}_Controller::{action},")
+            offset += len(key[3])
+        code.dedent()
+        code("};")
+        code()
+
+        code("static const Transition transitions[] = {")
+        code.indent()
+        code("{ NextStateUnchanged, false, 0, 0 },")
+        for key in entries:
+            next_state, checks, stall, actions = key
+            stall = "true" if stall else "false"
+            code(
+                f"{{ {next_state}, {stall}, {action_offsets[key]}, "
+                f"{len(actions)} }},"
+            )
+        code.dedent()
+        code("};")
+        code.dedent()
+
+        code(
+            """
+
+    const int idx = transitionIndex[HASH_FUN(state, event)];
+    if (idx == 0) {
+        panic("Invalid transition\\n"
+              "%s time: %d addr: %#x event: %s state: %s\\n",
+              name(), curCycle(), addr, event, state);
+    }
+
+    const Transition &trans = transitions[idx];
+"""
+        )
+        if has_wildcard:
+            code(
+                """
+    // When * is encountered as an end state of a transition, the next
+    // state is determined by calling the machine-specific getNextState
+    // function before any actions of the transition execute.
+    if (trans.nextState == NextStateWildcard) {
+        next_state = getNextState(addr);
+        m_curTransitionNextState = next_state;
+    } else if (trans.nextState != NextStateUnchanged) {
+"""
+            )
+        else:
+            code(
+                """
+    if (trans.nextState != NextStateUnchanged) {
+"""
+            )
+        code(
+            """
+        next_state = ${ident}_State(trans.nextState);
+        m_curTransitionNextState = next_state;
+    }
+"""
+        )
+
+        # Group the entries that share the same checks
+        checks = OrderedDict()
+        for key, idx in entries.items():
+            if key[1]:
+                checks.setdefault(key[1], []).append(idx)
+        if checks:
+            code()
+            code("    switch (idx) {")
+            for check, idxs in checks.items():
+                for idx in idxs:
+                    code(f"      case {idx}:")
+                code.indent()
+                code.indent()
+                for c in check:
+                    code(c)
+                code("break;")
+                code.dedent()
+                code.dedent()
+            code("      default:")
+            code("        break;")
+            code("    }")
+
+        args = self.actionArgs()
+        code(
+            """
+
+    if (trans.stall) {
+        return TransitionResult_ProtocolStall;
+    }
+
+    const Action *action = &actions[trans.firstAction];
+    for (int i = 0; i < trans.numActions; ++i) {
+        (this->*action[i])($args);
+    }
+
+    return TransitionResult_Valid;
+"""
+        )
+
+    def printCTransitionSwitch(self, code):
+        """Output the switch statement for the transition table"""
+
+        ident = self.ident
+        code("    switch(HASH_FUN(state, event)) {")
+
         # This map will allow suppress generating duplicate code
         cases = OrderedDict()
 
@@ -1761,67 +2062,15 @@ ${ident}_Controller::doTransitionWorker(${ident}_Event event,
                         "m_curTransitionNextState = next_state;"
                     )
 
-            actions = trans.actions
-            request_types = trans.request_types
-
-            # Check for resources
-            case_sorter = []
-            res = trans.resources
-            for key, val in res.items():
-                val = f"""
-if (!{key.code}.areNSlotsAvailable({val}, clockEdge()))
-    return TransitionResult_ResourceStall;
-"""
-                case_sorter.append(val)
-
-            # Check all of the request_types for resource constraints
-            for request_type in request_types:
-                val = """
-if (!checkResourceAvailable({}_RequestType_{}, addr)) {{
-    return TransitionResult_ResourceStall;
-}}
-""".format(
-                    self.ident,
-                    request_type.ident,
-                )
-                case_sorter.append(val)
-
-            # Emit the code sequences in a sorted order.  This makes the
-            # output deterministic (without this the output order can vary
-            # since Map's keys() on a vector of pointers is not deterministic
-            for c in sorted(case_sorter):
+            for c in self.transitionChecks(trans):
                 case("$c")
 
-            # Record access types for this transition
-            for request_type in request_types:
-                case(
-                    "recordRequestType(${ident}_RequestType_${{request_type.ident}}, addr);"
-                )
-
-            # Figure out if we stall
-            stall = False
-            for action in actions:
-                if action.ident == "z_stall":
-                    stall = True
-                    break
-
-            if stall:
+            if self.transitionStalls(trans):
                 case("return TransitionResult_ProtocolStall;")
             else:
-                if self.TBEType != None and self.EntryType != None:
-                    for action in actions:
-                        case(
-                            "${{action.ident}}(m_tbe_ptr, m_cache_entry_ptr, addr);"
-                        )
-                elif self.TBEType != None:
-                    for action in actions:
-                        case("${{action.ident}}(m_tbe_ptr, addr);")
-                elif self.EntryType != None:
-                    for action in actions:
-                        case("${{action.ident}}(m_cache_entry_ptr, addr);")
-                else:
-                    for action in actions:
-                        case("${{action.ident}}(addr);")
+                args = self.actionArgs()
+                for action in trans.actions:
+                    case("${{action.ident}}($args);")
                 case("return TransitionResult_Valid;")
 
             case = str(case)
@@ -1850,13 +2099,8 @@ if (!checkResourceAvailable({}_RequestType_{}, addr)) {{
     }
 
     return TransitionResult_Valid;
-}
-
-} // namespace ruby
-} // namespace gem5
 """
         )
-        code.write(path, f"{self.ident}_Transitions.cc")
 
     # **************************
     # ******* HTML Files *******
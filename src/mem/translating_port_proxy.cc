@@ -45,6 +45,8 @@
 
 #include "mem/translating_port_proxy.hh"
 
+#include <cstring>
+
 #include "arch/generic/mmu.hh"
 #include "base/chunk_generator.hh"
 #include "cpu/base.hh"
@@ -91,8 +93,13 @@ TranslatingPortProxy::tryReadBlob(Addr addr, void *p, uint64_t size) const
     constexpr auto mode = BaseMMU::Read;
     return tryOnBlob(mode, _tc->getMMUPtr()->translateFunctional(
             addr, size, _tc, mode, flags),
-        [this, &p](const auto &range) {
-            PortProxy::readBlobPhys(range.paddr, flags, p, range.size);
+        [this, &p, backdoor = MemBackdoorPtr()](const auto &range) mutable {
+            uint8_t *host = flags ? nullptr :
+                hostPtrPhys(range.paddr, range.size, false, backdoor);
+            if (host)
+                std::memcpy(p, host, range.size);
+            else
+                PortProxy::readBlobPhys(range.paddr, flags, p, range.size);
             p = static_cast<uint8_t *>(p) + range.size;
     });
 }
@@ -104,8 +111,13 @@ TranslatingPortProxy::tryWriteBlob(
     constexpr auto mode = BaseMMU::Write;
     return tryOnBlob(mode, _tc->getMMUPtr()->translateFunctional(
             addr, size, _tc, mode, flags),
-        [this, &p](const auto &range) {
-            PortProxy::writeBlobPhys(range.paddr, flags, p, range.size);
+        [this, &p, backdoor = MemBackdoorPtr()](const auto &range) mutable {
+            uint8_t *host = flags ? nullptr :
+                hostPtrPhys(range.paddr, range.size, true, backdoor);
+            if (host)
+                std::memcpy(host, p, range.size);
+            else
+                PortProxy::writeBlobPhys(range.paddr, flags, p, range.size);
             p = static_cast<const uint8_t *>(p) + range.size;
     });
 }
@@ -121,4 +133,35 @@ TranslatingPortProxy::tryMemsetBlob(Addr addr, uint8_t v, uint64_t size) const
     });
 }
 
+bool
+TranslatingPortProxy::tryHostRanges(Addr addr, uint64_t size, bool write,
+                                    std::vector<struct iovec> &iov) const
+{
+    iov.clear();
+    if (flags)
+        return false;
+
+    const auto mode = write ? BaseMMU::Write : BaseMMU::Read;
+    bool backed = true;
+    MemBackdoorPtr backdoor = nullptr;
+    bool translated = tryOnBlob(mode, _tc->getMMUPtr()->translateFunctional(
+            addr, size, _tc, mode, flags),
+        [&](const auto &range) {
+            if (!backed)
+                return;
+            uint8_t *host =
+                hostPtrPhys(range.paddr, range.size, write, backdoor);
+            if (!host) {
+                backed = false;
+            } else if (!iov.empty() &&
+                    (uint8_t *)iov.back().iov_base + iov.back().iov_len ==
+                    host) {
+                iov.back().iov_len += range.size;
+            } else {
+                iov.push_back({host, (size_t)range.size});
+            }
+    });
+    return translated && backed;
+}
+
 } // namespace gem5
@@ -41,7 +41,10 @@
 #ifndef __MEM_TRANSLATING_PORT_PROXY_HH__
 #define __MEM_TRANSLATING_PORT_PROXY_HH__
 
+#include <sys/uio.h>
+
 #include <functional>
+#include <vector>
 
 #include "arch/generic/mmu.hh"
 #include "mem/port_proxy.hh"
@@ -87,6 +90,19 @@ class TranslatingPortProxy : public PortProxy
      * Fill size bytes starting at addr with byte value val.
      */
     bool tryMemsetBlob(Addr address, uint8_t  v, uint64_t size) const override;
+
+    /**
+     * Get the host memory backing size bytes at addr, so that it can be
+     * accessed in place, e.g. by host system calls. This is only possible
+     * if all of it can be reached through memory back doors.
+     *
+     * @param write Whether the memory will be written to.
+     * @param iov The host memory ranges, in order. Contiguous ranges are
+     *            merged.
+     * @return Whether all of the memory is backed by host memory.
+     */
+    bool tryHostRanges(Addr addr, uint64_t size, bool write,
+                       std::vector<struct iovec> &iov) const;
 };
 
 } // namespace gem5
@@ -261,6 +261,13 @@ def parse_options():
         help="Create DOT & pdf outputs of the DVFS configuration"
         + " [Default: %default]",
     )
+    option(
+        "--startup-profile",
+        metavar="FILE",
+        default=None,
+        help="Write the time spent in each instantiation pass and by the "
+        "slowest SimObjects to FILE [Default: %default]",
+    )
 
     # Debugging options
     group("Debugging Options")
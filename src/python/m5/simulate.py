@@ -40,6 +40,7 @@
 import atexit
 import os
 import sys
+import time
 
 from m5.util.dot_writer import (
     do_dot,
@@ -99,14 +100,18 @@ def instantiate(ckpt_dir=None):
     for obj in root.descendants():
         obj.adoptOrphanParams()
 
+    # The hierarchy is complete now, so walk it only once
+    descendants = list(root.descendants())
+
+    profile = _StartupProfile() if options.startup_profile else None
+
     # Unproxy in sorted order for determinism
-    for obj in root.descendants():
-        obj.unproxyParams()
+    _run_pass(profile, "unproxy", descendants, lambda o: o.unproxyParams())
 
     if options.dump_config:
         ini_file = open(os.path.join(options.outdir, options.dump_config), "w")
         # Print ini sections in sorted order for easier diffing
-        for obj in sorted(root.descendants(), key=lambda o: o.path()):
+        for obj in sorted(descendants, key=lambda o: o.path()):
             obj.print_ini(ini_file)
         ini_file.close()
 
@@ -131,26 +136,31 @@ def instantiate(ckpt_dir=None):
     stats.initSimStats()
 
     # Create the C++ sim objects and connect ports
-    for obj in root.descendants():
-        obj.createCCObject()
-    for obj in root.descendants():
-        obj.connectPorts()
+    _run_pass(profile, "create", descendants, lambda o: o.createCCObject())
+    _run_pass(profile, "connect", descendants, lambda o: o.connectPorts())
 
     # Do a second pass to finish initializing the sim objects
-    for obj in root.descendants():
-        obj.init()
+    _run_pass(profile, "init", descendants, lambda o: o.init())
 
     # Do a third pass to initialize statistics
+    start = time.perf_counter()
     stats._bindStatHierarchy(root)
     root.regStats()
+    if profile:
+        profile.record("regStats", None, time.perf_counter() - start)
 
     # Do a fourth pass to initialize probe points
-    for obj in root.descendants():
-        obj.regProbePoints()
+    _run_pass(
+        profile, "regProbePoints", descendants, lambda o: o.regProbePoints()
+    )
 
     # Do a fifth pass to connect probe listeners
-    for obj in root.descendants():
-        obj.regProbeListeners()
+    _run_pass(
+        profile,
+        "regProbeListeners",
+        descendants,
+        lambda o: o.regProbeListeners(),
+    )
 
     # We want to generate the DVFS diagram for the system. This can only be
     # done once all of the CPP objects have been created and initialised so
@@ -165,19 +175,79 @@ def instantiate(ckpt_dir=None):
     if ckpt_dir:
         _drain_manager.preCheckpointRestore()
         ckpt = _m5.core.getCheckpoint(ckpt_dir)
-        for obj in root.descendants():
-            obj.loadState(ckpt)
+        _run_pass(
+            profile, "loadState", descendants, lambda o: o.loadState(ckpt)
+        )
     else:
-        for obj in root.descendants():
-            obj.initState()
+        _run_pass(profile, "initState", descendants, lambda o: o.initState())
 
     # Check to see if any of the stat events are in the past after resuming from
     # a checkpoint, If so, this call will shift them to be at a valid time.
     updateStatEvents()
 
+    if profile:
+        profile.write(os.path.join(options.outdir, options.startup_profile))
+
     gather_citations(root)
 
 
+class _StartupProfile:
+    """Time spent in each pass of m5.instantiate(), in total and per
+    SimObject"""
+
+    def __init__(self):
+        self.passes = {}
+        self.objects = {}
+
+    def record(self, name, obj, seconds):
+        """Record the time of a pass over obj, or of a whole pass if obj
+        is None"""
+        self.passes[name] = self.passes.get(name, 0.0) + seconds
+        if obj is not None:
+            self.objects.setdefault(obj, {})[name] = seconds
+
+    def write(self, path, num_objects=20):
+        with open(path, "w") as f:
+            total = sum(self.passes.values())
+            print(f"Time in instantiation passes: {total:.3f}s", file=f)
+            print("\nPer pass:", file=f)
+            for name, seconds in self.passes.items():
+                print(f"  {name:20} {seconds:10.3f}s", file=f)
+
+            # Creating an object also creates the SimObjects in its
+            # parameters, which are then charged to it
+            slowest = sorted(
+                self.objects.items(),
+                key=lambda item: sum(item[1].values()),
+                reverse=True,
+            )[:num_objects]
+            print(f"\nSlowest {len(slowest)} SimObjects:", file=f)
+            for obj, times in slowest:
+                breakdown = ", ".join(
+                    f"{name} {seconds:.3f}s"
+                    for name, seconds in times.items()
+                    if seconds >= 0.0005
+                )
+                print(
+                    f"  {obj.path():50} {sum(times.values()):10.3f}s"
+                    f" ({breakdown})",
+                    file=f,
+                )
+
+
+def _run_pass(profile, name, objs, func):
+    """Call func on each of objs, timing the calls if profiling"""
+    if profile is None:
+        for obj in objs:
+            func(obj)
+        return
+
+    for obj in objs:
+        start = time.perf_counter()
+        func(obj)
+        profile.record(name, obj, time.perf_counter() - start)
+
+
 need_startup = True
 
 
@@ -67,6 +67,12 @@ class Process(SimObject):
     simpoint = Param.UInt64(0, "simulation point at which to start simulation")
     drivers = VectorParam.EmulatedDriver([], "Available emulated drivers")
     release = Param.String("5.1.0", "Linux kernel uname release")
+    async_io_threads = Param.Unsigned(
+        0,
+        "Number of host threads running the file I/O syscalls "
+        "asynchronously, 0 to run them synchronously. This makes the "
+        "simulated time the syscalls take non-deterministic.",
+    )
 
     @classmethod
     def export_methods(cls, code):
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/async_io.hh"
+
+#include <cassert>
+#include <utility>
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+AsyncIO::AsyncIO(unsigned num_threads)
+{
+    fatal_if(!num_threads, "Asynchronous I/O needs at least one thread.");
+    for (unsigned i = 0; i < num_threads; i++)
+        workers.emplace_back([this]() { work(); });
+}
+
+AsyncIO::~AsyncIO()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeup.notify_all();
+    for (auto &worker: workers)
+        worker.join();
+}
+
+std::shared_ptr<AsyncIO::Request>
+AsyncIO::find(ContextID id) const
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = requests.find(id);
+    return it == requests.end() ? nullptr : it->second;
+}
+
+std::shared_ptr<AsyncIO::Request>
+AsyncIO::issue(ContextID id, std::vector<uint8_t> buffer, Operation op)
+{
+    auto req = std::make_shared<Request>(std::move(buffer));
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        panic_if(!requests.emplace(id, req).second,
+                 "Context %d already has an asynchronous I/O request.", id);
+        queue.emplace_back([req, op]() {
+            req->result = op(req->buffer);
+            req->done.store(true, std::memory_order_release);
+        });
+    }
+    wakeup.notify_one();
+    return req;
+}
+
+void
+AsyncIO::retire(ContextID id)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+    auto it = requests.find(id);
+    assert(it != requests.end() &&
+           it->second->done.load(std::memory_order_acquire));
+    requests.erase(it);
+}
+
+void
+AsyncIO::work()
+{
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeup.wait(lock, [this]() { return stopping || !queue.empty(); });
+            // Finish the queued requests before exiting, as the writes
+            // have already been accepted by the simulated program.
+            if (queue.empty())
+                return;
+            job = std::move(queue.front());
+            queue.pop_front();
+        }
+        job();
+    }
+}
+
+} // namespace gem5
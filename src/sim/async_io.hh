@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_ASYNC_IO_HH__
+#define __SIM_ASYNC_IO_HH__
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+/**
+ * A pool of host threads which run the host side of SE mode file I/O
+ * syscalls, so that the simulation doesn't stall while the host kernel
+ * does the I/O. Operations are issued on behalf of a thread context,
+ * which is suspended and retries its syscall until its operation has
+ * completed (see SyscallReturn::retry).
+ *
+ * Operations only access their own buffer, which is copied from and to
+ * the simulated memory by the syscall in the simulation thread.
+ */
+class AsyncIO
+{
+  public:
+    struct Request
+    {
+        /** Data read or to write by the operation. */
+        std::vector<uint8_t> buffer;
+        /** Result of the operation, a negated errno on failure. */
+        int64_t result = 0;
+        std::atomic<bool> done{false};
+
+        Request(std::vector<uint8_t> &&buf) : buffer(std::move(buf)) {}
+    };
+
+    /**
+     * A host operation on a request buffer. It returns the result of the
+     * host call, a negated errno on failure.
+     */
+    using Operation = std::function<int64_t(std::vector<uint8_t> &)>;
+
+    AsyncIO(unsigned num_threads);
+    /** Complete all the issued operations and stop the threads. */
+    ~AsyncIO();
+
+    unsigned numThreads() const { return workers.size(); }
+
+    /** The request in flight or completed for a context, if any. */
+    std::shared_ptr<Request> find(ContextID id) const;
+
+    /**
+     * Start an operation for a context, which mustn't have a request
+     * already.
+     *
+     * @param buffer The request buffer, e.g. holding the data to write.
+     */
+    std::shared_ptr<Request> issue(ContextID id, std::vector<uint8_t> buffer,
+                                   Operation op);
+
+    /** Forget the completed request of a context. */
+    void retire(ContextID id);
+
+  private:
+    void work();
+
+    std::vector<std::thread> workers;
+
+    mutable std::mutex mutex;
+    std::condition_variable wakeup;
+    std::deque<std::function<void()>> queue;
+    bool stopping = false;
+
+    std::unordered_map<ContextID, std::shared_ptr<Request>> requests;
+};
+
+} // namespace gem5
+
+#endif // __SIM_ASYNC_IO_HH__
@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/cxx_config_snapshot.hh"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+#include "base/logging.hh"
+#include "base/str.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+const char snapshotMagic[8] = {'g', 'e', 'm', '5', 'c', 'f', 'g', 's'};
+
+uint64_t
+fnv1a(const char *data, size_t size)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= static_cast<uint8_t>(data[i]);
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+template <typename T>
+void
+put(std::string &buf, T value)
+{
+    buf.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+void
+putString(std::string &buf, const std::string &str)
+{
+    put<uint32_t>(buf, str.size());
+    buf.append(str);
+}
+
+/** Bounds checked reader over a loaded snapshot */
+class Reader
+{
+  protected:
+    const std::string &buf;
+    size_t pos;
+
+  public:
+    Reader(const std::string &buf_, size_t pos_) : buf(buf_), pos(pos_) { }
+
+    bool done() const { return pos == buf.size(); }
+
+    template <typename T>
+    bool
+    get(T &value)
+    {
+        if (buf.size() - pos < sizeof(value))
+            return false;
+        std::memcpy(&value, buf.data() + pos, sizeof(value));
+        pos += sizeof(value);
+        return true;
+    }
+
+    bool
+    getString(std::string &str)
+    {
+        uint32_t size;
+        if (!get(size) || buf.size() - pos < size)
+            return false;
+        str.assign(buf, pos, size);
+        pos += size;
+        return true;
+    }
+};
+
+bool
+readFile(const std::string &filename, std::string &contents)
+{
+    std::ifstream file(filename, std::ios::binary);
+    if (!file)
+        return false;
+    contents.assign(std::istreambuf_iterator<char>(file),
+        std::istreambuf_iterator<char>());
+    return !file.bad();
+}
+
+} // anonymous namespace
+
+const CxxConfigSnapshot::Value *
+CxxConfigSnapshot::findValue(const std::string &object_name,
+    const std::string &param_name) const
+{
+    auto object = objects.find(object_name);
+    if (object == objects.end())
+        return NULL;
+
+    auto value = object->second.find(param_name);
+    if (value == object->second.end())
+        return NULL;
+
+    return &value->second;
+}
+
+bool
+CxxConfigSnapshot::getParam(const std::string &object_name,
+    const std::string &param_name,
+    std::string &value) const
+{
+    const Value *stored = findValue(object_name, param_name);
+    if (!stored)
+        return false;
+
+    if (!stored->isVector) {
+        value = stored->elements.front();
+    } else {
+        value.clear();
+        for (auto i = stored->elements.begin();
+            i != stored->elements.end(); ++i) {
+            if (i != stored->elements.begin())
+                value += ' ';
+            value += *i;
+        }
+    }
+
+    return true;
+}
+
+bool
+CxxConfigSnapshot::getParamVector(const std::string &object_name,
+    const std::string &param_name,
+    std::vector<std::string> &values) const
+{
+    const Value *stored = findValue(object_name, param_name);
+    if (!stored)
+        return false;
+
+    if (stored->isVector) {
+        values.insert(values.end(), stored->elements.begin(),
+            stored->elements.end());
+    } else {
+        tokenize(values, stored->elements.front(), ' ', true);
+    }
+
+    return true;
+}
+
+bool
+CxxConfigSnapshot::getPortPeers(const std::string &object_name,
+    const std::string &port_name,
+    std::vector<std::string> &peers) const
+{
+    return getParamVector(object_name, port_name, peers);
+}
+
+bool
+CxxConfigSnapshot::objectExists(const std::string &object_name) const
+{
+    return objects.find(object_name) != objects.end();
+}
+
+void
+CxxConfigSnapshot::getAllObjectNames(std::vector<std::string> &list) const
+{
+    for (auto i = objects.begin(); i != objects.end(); ++i)
+        list.push_back(i->first);
+}
+
+void
+CxxConfigSnapshot::getObjectChildren(const std::string &object_name,
+    std::vector<std::string> &children, bool return_paths) const
+{
+    if (!getParamVector(object_name, "children", children))
+        return;
+
+    if (return_paths && object_name != "root") {
+        for (auto i = children.begin(); i != children.end(); ++i)
+            *i = object_name + "." + *i;
+    }
+}
+
+bool
+CxxConfigSnapshot::load(const std::string &filename)
+{
+    std::string contents;
+    if (!readFile(filename, contents))
+        return false;
+
+    const size_t header_size = sizeof(snapshotMagic) + sizeof(uint32_t) +
+        3 * sizeof(uint64_t);
+
+    if (contents.size() < header_size ||
+        std::memcmp(contents.data(), snapshotMagic,
+            sizeof(snapshotMagic)) != 0) {
+        warn("%s is not a config snapshot\n", filename);
+        return false;
+    }
+
+    Reader header(contents, sizeof(snapshotMagic));
+    uint32_t file_version;
+    uint64_t directory_hash, source_hash, content_hash;
+    header.get(file_version);
+    header.get(directory_hash);
+    header.get(source_hash);
+    header.get(content_hash);
+
+    if (file_version != version) {
+        warn("Config snapshot %s has version %d, expected %d\n",
+            filename, file_version, version);
+        return false;
+    }
+
+    if (directory_hash != directoryHash()) {
+        warn("Config snapshot %s was written by a binary with different "
+            "SimObject parameters\n", filename);
+        return false;
+    }
+
+    if (fnv1a(contents.data() + header_size,
+            contents.size() - header_size) != content_hash) {
+        warn("Config snapshot %s is corrupt (content hash mismatch)\n",
+            filename);
+        return false;
+    }
+
+    std::map<std::string, Object> loaded;
+    Reader reader(contents, header_size);
+    uint32_t num_objects;
+    bool ok = reader.get(num_objects);
+
+    for (uint32_t i = 0; ok && i < num_objects; i++) {
+        std::string object_name;
+        uint32_t num_values;
+        ok = reader.getString(object_name) && reader.get(num_values);
+
+        Object &object = loaded[object_name];
+        for (uint32_t j = 0; ok && j < num_values; j++) {
+            std::string param_name;
+            uint8_t is_vector;
+            uint32_t num_elements;
+            ok = reader.getString(param_name) && reader.get(is_vector) &&
+                reader.get(num_elements);
+
+            Value &value = object[param_name];
+            value.isVector = is_vector;
+            for (uint32_t k = 0; ok && k < num_elements; k++) {
+                value.elements.emplace_back();
+                ok = reader.getString(value.elements.back());
+            }
+            ok = ok && (value.isVector || value.elements.size() == 1);
+        }
+    }
+
+    if (!ok || !reader.done()) {
+        warn("Config snapshot %s is malformed\n", filename);
+        return false;
+    }
+
+    objects.swap(loaded);
+    sourceHash = source_hash;
+
+    return true;
+}
+
+bool
+CxxConfigSnapshot::write(const CxxConfigFileBase &config,
+    const std::string &filename, uint64_t source_hash)
+{
+    std::vector<std::string> object_names;
+    config.getAllObjectNames(object_names);
+
+    std::string payload;
+    put<uint32_t>(payload, object_names.size());
+
+    for (auto &object_name : object_names) {
+        Object object;
+
+        std::string type;
+        if (config.getParam(object_name, "type", type))
+            object["type"] = Value{false, {type}};
+
+        std::vector<std::string> children;
+        config.getObjectChildren(object_name, children);
+        if (!children.empty())
+            object["children"] = Value{true, children};
+
+        auto entry = cxxConfigDirectory().find(type);
+        if (entry != cxxConfigDirectory().end()) {
+            for (auto &param : entry->second->parameters) {
+                Value value{param.second->isVector, {}};
+                bool found;
+
+                if (value.isVector) {
+                    found = config.getParamVector(object_name,
+                        param.first, value.elements);
+                } else {
+                    value.elements.emplace_back();
+                    found = config.getParam(object_name, param.first,
+                        value.elements.back());
+                }
+
+                if (found)
+                    object[param.first] = std::move(value);
+            }
+
+            for (auto &port : entry->second->ports) {
+                Value value{true, {}};
+                if (config.getPortPeers(object_name, port.first,
+                        value.elements)) {
+                    object[port.first] = std::move(value);
+                }
+            }
+        } else {
+            warn("Config snapshot: no directory entry for %s (type '%s'),"
+                " only its type and children are stored\n",
+                object_name, type);
+        }
+
+        putString(payload, object_name);
+        put<uint32_t>(payload, object.size());
+        for (auto &value : object) {
+            putString(payload, value.first);
+            put<uint8_t>(payload, value.second.isVector);
+            put<uint32_t>(payload, value.second.elements.size());
+            for (auto &element : value.second.elements)
+                putString(payload, element);
+        }
+    }
+
+    std::string header(snapshotMagic, sizeof(snapshotMagic));
+    put<uint32_t>(header, version);
+    put<uint64_t>(header, directoryHash());
+    put<uint64_t>(header, source_hash);
+    put<uint64_t>(header, fnv1a(payload.data(), payload.size()));
+
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    file << header << payload;
+    file.close();
+
+    return !file.fail();
+}
+
+uint64_t
+CxxConfigSnapshot::directoryHash()
+{
+    std::string desc;
+    for (auto &entry : cxxConfigDirectory()) {
+        putString(desc, entry.first);
+        put<uint32_t>(desc, entry.second->parameters.size());
+        for (auto &param : entry.second->parameters) {
+            putString(desc, param.first);
+            put<uint8_t>(desc, param.second->isVector);
+            put<uint8_t>(desc, param.second->isSimObject);
+        }
+        put<uint32_t>(desc, entry.second->ports.size());
+        for (auto &port : entry.second->ports) {
+            putString(desc, port.first);
+            put<uint8_t>(desc, port.second->isVector);
+            put<uint8_t>(desc, port.second->isRequestor);
+        }
+    }
+    return fnv1a(desc.data(), desc.size());
+}
+
+uint64_t
+CxxConfigSnapshot::hashFile(const std::string &filename)
+{
+    std::string contents;
+    if (!readFile(filename, contents))
+        return 0;
+    return fnv1a(contents.data(), contents.size());
+}
+
+} // namespace gem5
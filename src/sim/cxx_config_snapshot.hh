@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *
+ *  Pre-parsed config snapshot for use with CxxConfigManager.  A snapshot
+ *  holds every value CxxConfigManager will ask for, already split into
+ *  vector elements, together with a hash of its own contents, a hash
+ *  of the config it was generated from and a hash of the SimObject
+ *  parameter directory of the binary that wrote it.  Loading one needs
+ *  no .ini parsing and no tokenizing, and a stale or damaged snapshot,
+ *  or one written by a binary with different SimObject parameters, is
+ *  detected rather than silently instantiated.
+ */
+
+#ifndef __SIM_CXX_CONFIG_SNAPSHOT_HH__
+#define __SIM_CXX_CONFIG_SNAPSHOT_HH__
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "sim/cxx_config.hh"
+
+namespace gem5
+{
+
+/** CxxConfigManager interface for using config snapshots */
+class CxxConfigSnapshot : public CxxConfigFileBase
+{
+  public:
+    /** Bumped whenever the on-disk layout changes */
+    static constexpr uint32_t version = 2;
+
+  protected:
+    /** A single stored value.  Scalars keep their string unchanged,
+     *  vectors are stored as their separated elements */
+    struct Value
+    {
+        bool isVector;
+        std::vector<std::string> elements;
+    };
+
+    typedef std::map<std::string, Value> Object;
+
+    std::map<std::string, Object> objects;
+
+    /** Hash of the config the snapshot was written from */
+    uint64_t sourceHash;
+
+    const Value *findValue(const std::string &object_name,
+        const std::string &param_name) const;
+
+  public:
+    CxxConfigSnapshot() : sourceHash(0) { }
+
+    bool getParam(const std::string &object_name,
+        const std::string &param_name,
+        std::string &value) const;
+
+    bool getParamVector(const std::string &object_name,
+        const std::string &param_name,
+        std::vector<std::string> &values) const;
+
+    bool getPortPeers(const std::string &object_name,
+        const std::string &port_name,
+        std::vector<std::string> &peers) const;
+
+    bool objectExists(const std::string &object_name) const;
+
+    void getAllObjectNames(std::vector<std::string> &list) const;
+
+    void getObjectChildren(const std::string &object_name,
+        std::vector<std::string> &children,
+        bool return_paths = false) const;
+
+    /** Load a snapshot.  Fails if the file can't be read, was written by
+     *  a different snapshot version, its content hash doesn't match or it
+     *  was written against a different parameter directory */
+    bool load(const std::string &filename);
+
+    /** The source hash recorded when the snapshot was written */
+    uint64_t getSourceHash() const { return sourceHash; }
+
+    /** Write a snapshot of config.  Every object's type and children are
+     *  stored along with the parameters and ports its type's
+     *  CxxConfigDirectoryEntry describes, which is everything
+     *  CxxConfigManager reads.  source_hash is recorded verbatim so
+     *  callers can check the snapshot against its origin, usually with
+     *  hashFile on the original config file */
+    static bool write(const CxxConfigFileBase &config,
+        const std::string &filename, uint64_t source_hash = 0);
+
+    /** Hash of the names and shapes of every parameter and port in
+     *  cxxConfigDirectory().  Snapshots only store what the directory
+     *  describes, so one written by a binary whose SimObjects have
+     *  different parameters can't be trusted */
+    static uint64_t directoryHash();
+
+    /** 64-bit FNV-1a hash of a file's contents.  Returns 0 if the file
+     *  can't be read */
+    static uint64_t hashFile(const std::string &filename);
+};
+
+} // namespace gem5
+
+#endif // __SIM_CXX_CONFIG_SNAPSHOT_HH__
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "base/str.hh"
+#include "sim/cxx_config.hh"
+#include "sim/cxx_config_snapshot.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** An in-memory config: object -> param -> value, with ports and vector
+ *  params stored as space separated strings like a .ini would */
+class FakeConfig : public CxxConfigFileBase
+{
+  public:
+    std::map<std::string, std::map<std::string, std::string>> objects;
+
+    bool
+    getParam(const std::string &object_name, const std::string &param_name,
+        std::string &value) const override
+    {
+        auto object = objects.find(object_name);
+        if (object == objects.end())
+            return false;
+        auto param = object->second.find(param_name);
+        if (param == object->second.end())
+            return false;
+        value = param->second;
+        return true;
+    }
+
+    bool
+    getParamVector(const std::string &object_name,
+        const std::string &param_name,
+        std::vector<std::string> &values) const override
+    {
+        std::string value;
+        if (!getParam(object_name, param_name, value))
+            return false;
+        tokenize(values, value, ' ', true);
+        return true;
+    }
+
+    bool
+    getPortPeers(const std::string &object_name,
+        const std::string &port_name,
+        std::vector<std::string> &peers) const override
+    {
+        return getParamVector(object_name, port_name, peers);
+    }
+
+    bool
+    objectExists(const std::string &object_name) const override
+    {
+        return objects.count(object_name);
+    }
+
+    void
+    getAllObjectNames(std::vector<std::string> &list) const override
+    {
+        for (auto &object : objects)
+            list.push_back(object.first);
+    }
+
+    void
+    getObjectChildren(const std::string &object_name,
+        std::vector<std::string> &children,
+        bool return_paths = false) const override
+    {
+        getParamVector(object_name, "children", children);
+    }
+
+    bool load(const std::string &filename) override { return false; }
+};
+
+class CxxConfigSnapshotTest : public testing::Test
+{
+  protected:
+    CxxConfigDirectoryEntry entry;
+    FakeConfig config;
+    char filename[32] = "snapshot-XXXXXX";
+
+    void
+    SetUp() override
+    {
+        entry.parameters["size"] =
+            new CxxConfigDirectoryEntry::ParamDesc("size", false, false);
+        entry.parameters["ranges"] =
+            new CxxConfigDirectoryEntry::ParamDesc("ranges", true, false);
+        entry.ports["port"] =
+            new CxxConfigDirectoryEntry::PortDesc("port", true, false);
+        cxxConfigDirectory()["FakeObject"] = &entry;
+
+        config.objects["root"] = {{"type", "Root"},
+            {"children", "obj"}};
+        config.objects["obj"] = {{"type", "FakeObject"},
+            {"size", "64kB"}, {"ranges", "0:1 2:3 4:5"},
+            {"port", "a.b c.d"}, {"ignored", "1"}};
+
+        int fd = mkstemp(filename);
+        ASSERT_NE(-1, fd);
+        close(fd);
+    }
+
+    void
+    TearDown() override
+    {
+        unlink(filename);
+        cxxConfigDirectory().erase("FakeObject");
+        for (auto &param : entry.parameters)
+            delete param.second;
+        for (auto &port : entry.ports)
+            delete port.second;
+    }
+
+    std::string
+    readBack()
+    {
+        std::ifstream file(filename, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file),
+            std::istreambuf_iterator<char>());
+    }
+
+    void
+    rewrite(const std::string &contents)
+    {
+        std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+        file << contents;
+    }
+};
+
+} // anonymous namespace
+
+TEST_F(CxxConfigSnapshotTest, WriteLoadCompare)
+{
+    ASSERT_TRUE(CxxConfigSnapshot::write(config, filename, 1234));
+
+    CxxConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.load(filename));
+    EXPECT_EQ(1234, snapshot.getSourceHash());
+
+    std::vector<std::string> names;
+    snapshot.getAllObjectNames(names);
+    EXPECT_EQ((std::vector<std::string>{"obj", "root"}), names);
+
+    std::string value;
+    ASSERT_TRUE(snapshot.getParam("obj", "type", value));
+    EXPECT_EQ("FakeObject", value);
+    ASSERT_TRUE(snapshot.getParam("obj", "size", value));
+    EXPECT_EQ("64kB", value);
+    ASSERT_TRUE(snapshot.getParam("obj", "ranges", value));
+    EXPECT_EQ("0:1 2:3 4:5", value);
+    // Only what the directory describes is stored
+    EXPECT_FALSE(snapshot.getParam("obj", "ignored", value));
+
+    std::vector<std::string> values;
+    ASSERT_TRUE(snapshot.getParamVector("obj", "ranges", values));
+    EXPECT_EQ((std::vector<std::string>{"0:1", "2:3", "4:5"}), values);
+
+    std::vector<std::string> peers;
+    ASSERT_TRUE(snapshot.getPortPeers("obj", "port", peers));
+    EXPECT_EQ((std::vector<std::string>{"a.b", "c.d"}), peers);
+
+    std::vector<std::string> children;
+    snapshot.getObjectChildren("root", children, true);
+    EXPECT_EQ((std::vector<std::string>{"obj"}), children);
+}
+
+TEST_F(CxxConfigSnapshotTest, RejectTruncated)
+{
+    ASSERT_TRUE(CxxConfigSnapshot::write(config, filename));
+    std::string contents = readBack();
+
+    // Cut inside the payload and inside the header
+    for (size_t size : {contents.size() - 1, contents.size() / 2,
+            size_t(10), size_t(0)}) {
+        rewrite(contents.substr(0, size));
+        CxxConfigSnapshot snapshot;
+        EXPECT_FALSE(snapshot.load(filename)) << "size " << size;
+    }
+}
+
+TEST_F(CxxConfigSnapshotTest, RejectCorrupted)
+{
+    ASSERT_TRUE(CxxConfigSnapshot::write(config, filename, 1234));
+    std::string contents = readBack();
+
+    // Magic, version and directory hash come before the source hash
+    const size_t source_hash_pos = 8 + 4 + 8;
+
+    for (size_t pos = 0; pos < contents.size(); pos++) {
+        std::string corrupted = contents;
+        corrupted[pos] ^= 0x20;
+        rewrite(corrupted);
+
+        CxxConfigSnapshot snapshot;
+        if (pos >= source_hash_pos && pos < source_hash_pos + 8) {
+            // Checking the source hash is up to the caller, who compares
+            // it against the hash of the config file
+            ASSERT_TRUE(snapshot.load(filename)) << "byte " << pos;
+            EXPECT_NE(1234, snapshot.getSourceHash()) << "byte " << pos;
+        } else {
+            EXPECT_FALSE(snapshot.load(filename)) << "byte " << pos;
+        }
+    }
+}
+
+TEST_F(CxxConfigSnapshotTest, RejectDifferentDirectory)
+{
+    ASSERT_TRUE(CxxConfigSnapshot::write(config, filename));
+
+    {
+        CxxConfigSnapshot snapshot;
+        EXPECT_TRUE(snapshot.load(filename));
+    }
+
+    // A binary whose FakeObject grew a parameter
+    entry.parameters["assoc"] =
+        new CxxConfigDirectoryEntry::ParamDesc("assoc", false, false);
+    {
+        CxxConfigSnapshot snapshot;
+        EXPECT_FALSE(snapshot.load(filename));
+    }
+
+    // ...or whose parameter changed shape
+    delete entry.parameters["assoc"];
+    entry.parameters.erase("assoc");
+    delete entry.parameters["size"];
+    entry.parameters["size"] =
+        new CxxConfigDirectoryEntry::ParamDesc("size", true, false);
+    {
+        CxxConfigSnapshot snapshot;
+        EXPECT_FALSE(snapshot.load(filename));
+    }
+}
+
+TEST_F(CxxConfigSnapshotTest, FailedLoadKeepsContents)
+{
+    ASSERT_TRUE(CxxConfigSnapshot::write(config, filename, 1));
+    CxxConfigSnapshot snapshot;
+    ASSERT_TRUE(snapshot.load(filename));
+
+    rewrite("not a snapshot");
+    EXPECT_FALSE(snapshot.load(filename));
+    EXPECT_TRUE(snapshot.objectExists("obj"));
+    EXPECT_EQ(1, snapshot.getSourceHash());
+}
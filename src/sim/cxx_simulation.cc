@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/cxx_simulation.hh"
+
+#include "base/logging.hh"
+#include "base/statistics.hh"
+#include "base/stats/group.hh"
+#include "sim/core.hh"
+#include "sim/cur_tick.hh"
+#include "sim/drain.hh"
+#include "sim/eventq.hh"
+#include "sim/init_signals.hh"
+#include "sim/serialize.hh"
+#include "sim/sim_events.hh"
+#include "sim/sim_object.hh"
+#include "sim/simulate.hh"
+#include "sim/stat_control.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+/** Has a CxxSimulation been created? */
+bool simulationCreated = false;
+
+void
+defaultStatsReset()
+{
+    for (auto *info : statistics::statsList())
+        info->reset();
+    statistics::processResetQueue();
+}
+
+void
+defaultStatsDump()
+{
+    statistics::processDumpQueue();
+}
+
+void
+snapshotGroup(std::map<std::string, double> &values,
+    const std::string &prefix, const statistics::Group &group)
+{
+    for (auto *info : group.getStats()) {
+        const std::string name = prefix + "." + info->name;
+
+        if (auto *scalar = dynamic_cast<statistics::ScalarInfo *>(info)) {
+            values[name] = scalar->result();
+        } else if (auto *vector =
+                dynamic_cast<statistics::VectorInfo *>(info)) {
+            const statistics::VResult &result = vector->result();
+            for (size_t i = 0; i < result.size(); i++) {
+                const bool has_subname = i < vector->subnames.size() &&
+                    !vector->subnames[i].empty();
+                values[name + "." + (has_subname ? vector->subnames[i] :
+                        std::to_string(i))] = result[i];
+            }
+            values[name + ".total"] = vector->total();
+        }
+    }
+
+    for (auto &sub_group : group.getStatGroups())
+        snapshotGroup(values, prefix + "." + sub_group.first,
+            *sub_group.second);
+}
+
+} // anonymous namespace
+
+void
+CxxSimulation::initialize(Tick ticks_per_second,
+    void (*reset_handler)(), void (*dump_handler)())
+{
+    initSignals();
+
+    setClockFrequency(ticks_per_second);
+    fixClockFrequency();
+    curEventQueue(getEventQueue(0));
+
+    statistics::initSimStats();
+    statistics::registerHandlers(
+        reset_handler ? reset_handler : defaultStatsReset,
+        dump_handler ? dump_handler : defaultStatsDump);
+}
+
+CxxSimulation::CxxSimulation(CxxConfigFileBase &config) :
+    manager(config), instantiated(false)
+{
+    fatal_if(simulationCreated,
+        "Only one CxxSimulation can be created per process.");
+    simulationCreated = true;
+}
+
+void
+CxxSimulation::instantiate()
+{
+    panic_if(instantiated, "CxxSimulation instantiated twice.");
+
+    manager.instantiate();
+
+    for (auto *info : statistics::statsList())
+        info->enable();
+    if (!statistics::enabled())
+        statistics::enable();
+
+    manager.initState();
+    manager.startup();
+
+    instantiated = true;
+}
+
+void
+CxxSimulation::restore(const std::string &dir)
+{
+    panic_if(instantiated, "CxxSimulation instantiated twice.");
+
+    manager.instantiate();
+
+    for (auto *info : statistics::statsList())
+        info->enable();
+    if (!statistics::enabled())
+        statistics::enable();
+
+    SimObject::setSimObjectResolver(&manager.getSimObjectResolver());
+    CheckpointIn checkpoint(dir);
+
+    DrainManager::instance().preCheckpointRestore();
+    manager.loadState(checkpoint);
+    manager.startup();
+    manager.drainResume();
+
+    instantiated = true;
+}
+
+CxxSimulation::ExitStatus
+CxxSimulation::simulateUntil(Tick when)
+{
+    panic_if(!instantiated, "CxxSimulation simulated before instantiate.");
+
+    if (when <= curTick())
+        return ExitStatus{curTick(), "simulate() limit reached", 0};
+
+    set_max_tick(when);
+    GlobalSimLoopExitEvent *exit_event = simulate();
+
+    return ExitStatus{curTick(), exit_event->getCause(),
+        exit_event->getCode()};
+}
+
+CxxSimulation::ExitStatus
+CxxSimulation::simulateFor(Tick ticks)
+{
+    return simulateUntil(ticks < MaxTick - curTick() ?
+        curTick() + ticks : MaxTick);
+}
+
+void
+CxxSimulation::drain()
+{
+    while (manager.drain() != 0)
+        simulate();
+}
+
+void
+CxxSimulation::checkpoint(const std::string &dir)
+{
+    panic_if(!instantiated, "CxxSimulation checkpointed before "
+        "instantiate.");
+
+    drain();
+    SimObject::serializeAll(dir);
+    manager.drainResume();
+}
+
+std::map<std::string, double>
+CxxSimulation::statsSnapshot()
+{
+    statistics::processDumpQueue();
+
+    for (auto *info : statistics::statsList())
+        info->prepare();
+
+    std::map<std::string, double> values;
+    for (auto *object : manager.objectsInOrder)
+        snapshotGroup(values, object->name(), *object);
+
+    return values;
+}
+
+void
+CxxSimulation::resetStats()
+{
+    statistics::reset();
+}
+
+} // namespace gem5
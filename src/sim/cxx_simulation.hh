@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *
+ *  Driver for simulations configured through CxxConfigManager.  This
+ *  wraps the process setup, instantiation, run, checkpoint and stats
+ *  steps a C++-only host would otherwise have to copy from
+ *  util/cxx_config so gem5 can be built as a library and driven
+ *  entirely from C++.
+ *
+ *  gem5's simulated time, event queues, SimObject lists and stats are
+ *  process wide and can't be rewound, so only one CxxSimulation can be
+ *  created per process.  Run independent simulations in separate
+ *  processes.
+ */
+
+#ifndef __SIM_CXX_SIMULATION_HH__
+#define __SIM_CXX_SIMULATION_HH__
+
+#include <map>
+#include <string>
+
+#include "base/types.hh"
+#include "sim/cxx_manager.hh"
+
+namespace gem5
+{
+
+class CxxConfigFileBase;
+
+class CxxSimulation
+{
+  public:
+    /** Why a call to simulate returned */
+    struct ExitStatus
+    {
+        Tick when;
+        std::string cause;
+        int code;
+    };
+
+  protected:
+    CxxConfigManager manager;
+
+    /** Has instantiate or restore been called? */
+    bool instantiated;
+
+    /** Keep simulating until the DrainManager reports all objects
+     *  drained */
+    void drain();
+
+  public:
+    /** One-time process setup: signal handlers, the tick frequency and
+     *  the simulator's stats.  Must be called before the first
+     *  CxxSimulation is created.  Stats dumps and resets requested by the
+     *  simulated system are routed to reset_handler and dump_handler if
+     *  given */
+    static void initialize(Tick ticks_per_second = 1000000000000ULL,
+        void (*reset_handler)() = nullptr,
+        void (*dump_handler)() = nullptr);
+
+    /** Prepare to build the system described by config.  config must
+     *  outlive the CxxSimulation.  Parameters can be overridden through
+     *  getManager() until instantiate or restore is called */
+    CxxSimulation(CxxConfigFileBase &config);
+
+    CxxConfigManager &getManager() { return manager; }
+
+    /** Build the system and bring it to the point where it can be
+     *  simulated from tick 0.  Throws CxxConfigManager::Exception on
+     *  config errors */
+    void instantiate();
+
+    /** As instantiate, but restore the system's state from the
+     *  checkpoint in dir */
+    void restore(const std::string &dir);
+
+    /** Simulate until tick when or until the simulation exits for
+     *  another reason, whichever is first */
+    ExitStatus simulateUntil(Tick when = MaxTick);
+
+    /** Simulate for at most ticks more ticks */
+    ExitStatus simulateFor(Tick ticks);
+
+    /** Drain the system, write a checkpoint to dir and resume */
+    void checkpoint(const std::string &dir);
+
+    /** Capture the current value of every scalar, vector and formula
+     *  stat of every object, keyed by full stat name.  Vector elements
+     *  are named by their subname or index and totals as ".total" */
+    std::map<std::string, double> statsSnapshot();
+
+    /** Reset every stat, as a stats reset from the simulated system
+     *  would */
+    void resetStats();
+
+    /** Find an object by its config file name */
+    template<typename SimObjectType>
+    SimObjectType &
+    getObject(const std::string &object_name)
+    {
+        return manager.getObject<SimObjectType>(object_name);
+    }
+};
+
+} // namespace gem5
+
+#endif // __SIM_CXX_SIMULATION_HH__
@@ -28,6 +28,9 @@
 
 #include <sim/futex_map.hh>
 
+#include "cpu/base.hh"
+#include "sim/eventq.hh"
+
 namespace gem5
 {
 
@@ -49,6 +52,15 @@ WaiterState::checkMask(int wakeup_bitmask) const
     return bitmask & wakeup_bitmask;
 }
 
+void
+FutexMap::activate(const std::vector<ThreadContext *> &tcs)
+{
+    for (auto tc: tcs) {
+        EventQueue::ScopedMigration migrate(tc->getCpuPtr()->eventQueue());
+        tc->activate();
+    }
+}
+
 void
 FutexMap::suspend(Addr addr, uint64_t tgid, ThreadContext *tc)
 {
@@ -58,37 +70,43 @@ FutexMap::suspend(Addr addr, uint64_t tgid, ThreadContext *tc)
 int
 FutexMap::wakeup(Addr addr, uint64_t tgid, int count)
 {
-    FutexKey key(addr, tgid);
-    auto it = find(key);
-
-    if (it == end())
-        return 0;
-
-    int woken_up = 0;
-    auto &waiterList = it->second;
+    std::vector<ThreadContext *> woken;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        FutexKey key(addr, tgid);
+        auto it = find(key);
+
+        if (it == end())
+            return 0;
+
+        auto &waiterList = it->second;
+
+        while (!waiterList.empty() && (int)woken.size() < count) {
+            // Threads may be woken up by access to locked
+            // memory addresses outside of syscalls, so we
+            // must only count threads that were actually
+            // woken up by this syscall.
+            auto tc = waiterList.front().tc;
+            woken.push_back(tc);
+            waiterList.pop_front();
+            waitingTcs.erase(tc);
+        }
 
-    while (!waiterList.empty() && woken_up < count) {
-        // Threads may be woken up by access to locked
-        // memory addresses outside of syscalls, so we
-        // must only count threads that were actually
-        // woken up by this syscall.
-        auto& tc = waiterList.front().tc;
-        tc->activate();
-        woken_up++;
-        waiterList.pop_front();
-        waitingTcs.erase(tc);
+        if (waiterList.empty())
+            erase(it);
     }
 
-    if (waiterList.empty())
-        erase(it);
-
-    return woken_up;
+    activate(woken);
+    return woken.size();
 }
 
 void
 FutexMap::suspend_bitset(Addr addr, uint64_t tgid, ThreadContext *tc,
                int bitmask)
 {
+    std::lock_guard<std::mutex> lock(mutex);
+
     FutexKey key(addr, tgid);
     auto it = find(key);
 
@@ -100,90 +118,106 @@ FutexMap::suspend_bitset(Addr addr, uint64_t tgid, ThreadContext *tc,
     }
     waitingTcs.emplace(tc);
 
-    /** Suspend the thread context */
+    /**
+     * Suspend the thread context. This is done with the map locked so
+     * that a wakeup from another event queue can't be missed.
+     */
     tc->suspend();
 }
 
 int
 FutexMap::wakeup_bitset(Addr addr, uint64_t tgid, int bitmask)
 {
-    FutexKey key(addr, tgid);
-    auto it = find(key);
+    std::vector<ThreadContext *> woken;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
 
-    if (it == end())
-        return 0;
+        FutexKey key(addr, tgid);
+        auto it = find(key);
 
-    int woken_up = 0;
+        if (it == end())
+            return 0;
 
-    auto &waiterList = it->second;
-    auto iter = waiterList.begin();
+        auto &waiterList = it->second;
+        auto iter = waiterList.begin();
 
-    while (iter != waiterList.end()) {
-        WaiterState& waiter = *iter;
+        while (iter != waiterList.end()) {
+            WaiterState& waiter = *iter;
 
-        if (waiter.checkMask(bitmask)) {
-            waiter.tc->activate();
-            waitingTcs.erase(waiter.tc);
-            iter = waiterList.erase(iter);
-            woken_up++;
-        } else {
-            ++iter;
+            if (waiter.checkMask(bitmask)) {
+                woken.push_back(waiter.tc);
+                waitingTcs.erase(waiter.tc);
+                iter = waiterList.erase(iter);
+            } else {
+                ++iter;
+            }
         }
-    }
 
-    if (waiterList.empty())
-        erase(it);
+        if (waiterList.empty())
+            erase(it);
+    }
 
-    return woken_up;
+    activate(woken);
+    return woken.size();
 }
 
 int
 FutexMap::requeue(Addr addr1, uint64_t tgid, int count, int count2, Addr addr2)
 {
-    FutexKey key1(addr1, tgid);
-    auto it1 = find(key1);
+    std::vector<ThreadContext *> woken;
+    int requeued = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
 
-    if (it1 == end())
-        return 0;
+        FutexKey key1(addr1, tgid);
+        auto it1 = find(key1);
 
-    int woken_up = 0;
-    auto &waiterList1 = it1->second;
+        if (it1 == end())
+            return 0;
 
-    while (!waiterList1.empty() && woken_up < count) {
-        waiterList1.front().tc->activate();
-        waiterList1.pop_front();
-        woken_up++;
-    }
+        auto &waiterList1 = it1->second;
 
-    WaiterList tmpList;
-    int requeued = 0;
+        while (!waiterList1.empty() && (int)woken.size() < count) {
+            auto tc = waiterList1.front().tc;
+            woken.push_back(tc);
+            waiterList1.pop_front();
+            waitingTcs.erase(tc);
+        }
 
-    while (!waiterList1.empty() && requeued < count2) {
-      auto w = waiterList1.front();
-      waiterList1.pop_front();
-      tmpList.push_back(w);
-      requeued++;
-    }
+        WaiterList tmpList;
 
-    FutexKey key2(addr2, tgid);
-    auto it2 = find(key2);
+        while (!waiterList1.empty() && requeued < count2) {
+          auto w = waiterList1.front();
+          waiterList1.pop_front();
+          tmpList.push_back(w);
+          requeued++;
+        }
 
-    if (it2 == end() && requeued > 0) {
-        insert({key2, tmpList});
-    } else {
-        it2->second.insert(it2->second.end(),
-                           tmpList.begin(), tmpList.end());
-    }
+        FutexKey key2(addr2, tgid);
+        auto it2 = find(key2);
 
-    if (waiterList1.empty())
-        erase(it1);
+        if (it2 == end() && requeued > 0) {
+            insert({key2, tmpList});
+        } else {
+            it2->second.insert(it2->second.end(),
+                               tmpList.begin(), tmpList.end());
+        }
+
+        // Look the first futex up again, in case inserting the second
+        // one rehashed the map.
+        it1 = find(key1);
+        if (it1->second.empty())
+            erase(it1);
+    }
 
-    return woken_up + requeued;
+    activate(woken);
+    return woken.size() + requeued;
 }
 
 bool
 FutexMap::is_waiting(ThreadContext *tc)
 {
+    std::lock_guard<std::mutex> lock(mutex);
     return waitingTcs.find(tc) != waitingTcs.end();
 }
 
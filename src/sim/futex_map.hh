@@ -29,8 +29,10 @@
 #ifndef __FUTEX_MAP_HH__
 #define __FUTEX_MAP_HH__
 
+#include <mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include <cpu/thread_context.hh>
 
@@ -105,6 +107,11 @@ typedef std::list<WaiterState> WaiterList;
 
 /**
  * FutexMap class holds a map of all futexes used in the system
+ *
+ * The map is shared by all the processes of the system, which may run
+ * on different event queues (i.e. host threads). Woken up threads are
+ * only activated once the map is unlocked, from their own event queue,
+ * so that no event queue is locked while the map is.
  */
 class FutexMap : public std::unordered_map<FutexKey, WaiterList>
 {
@@ -139,8 +146,12 @@ class FutexMap : public std::unordered_map<FutexKey, WaiterList>
     bool is_waiting(ThreadContext *tc);
 
   private:
+    /** Activate woken up threads, with the map unlocked. */
+    static void activate(const std::vector<ThreadContext *> &tcs);
 
     std::unordered_set<ThreadContext *> waitingTcs;
+
+    std::mutex mutex;
 };
 
 } // namespace gem5
@@ -37,6 +37,11 @@
 
 #include "sim/linear_solver.hh"
 
+#include <algorithm>
+#include <cmath>
+
+#include "base/logging.hh"
+
 namespace gem5
 {
 
@@ -87,4 +92,247 @@ LinearSystem::solve() const
     return ret;
 }
 
+std::string
+SparseLinearSystem::toStr() const
+{
+    std::ostringstream oss;
+    for (unsigned eq = 0; eq < rows.size(); eq++) {
+        for (const auto &[unkw, v]: rows[eq])
+            oss << v << "*x" << unkw << " + ";
+        oss << "c" << eq << " = 0\n";
+    }
+    return oss.str();
+}
+
+std::vector <unsigned>
+SparseLinearSystem::eliminationOrder() const
+{
+    unsigned size = rows.size();
+
+    // Symmetrised pattern of the matrix, as adjacency lists
+    std::vector <std::pair<unsigned, unsigned>> edges;
+    for (unsigned eq = 0; eq < size; eq++) {
+        for (const auto &coeff: rows[eq]) {
+            if (coeff.first != eq) {
+                edges.emplace_back(eq, coeff.first);
+                edges.emplace_back(coeff.first, eq);
+            }
+        }
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    std::vector <size_t> start(size + 1, 0);
+    for (const auto &edge: edges)
+        start[edge.first + 1]++;
+    for (unsigned n = 0; n < size; n++)
+        start[n + 1] += start[n];
+    auto degree = [&](unsigned n) { return start[n + 1] - start[n]; };
+
+    // Nodes of the component of root by increasing distance from it
+    const unsigned unreached = size;
+    std::vector <unsigned> dist(size, unreached);
+    auto levels = [&](unsigned root, std::vector <unsigned> &nodes) {
+        nodes.assign(1, root);
+        dist[root] = 0;
+        for (size_t i = 0; i < nodes.size(); i++) {
+            for (size_t e = start[nodes[i]]; e < start[nodes[i] + 1]; e++) {
+                unsigned adj = edges[e].second;
+                if (dist[adj] == unreached) {
+                    dist[adj] = dist[nodes[i]] + 1;
+                    nodes.push_back(adj);
+                }
+            }
+        }
+    };
+
+    std::vector <unsigned> visit;
+    std::vector <bool> placed(size, false);
+    std::vector <unsigned> nodes, next;
+    for (unsigned seed = 0; seed < size; seed++) {
+        if (placed[seed])
+            continue;
+
+        // Start from a pseudo-peripheral node, which keeps the levels
+        // and so the bandwidth narrow
+        unsigned root = seed;
+        levels(root, nodes);
+        while (true) {
+            unsigned depth = dist[nodes.back()];
+            unsigned cand = nodes.back();
+            for (auto n: nodes)
+                if (dist[n] == depth && degree(n) < degree(cand))
+                    cand = n;
+            for (auto n: nodes)
+                dist[n] = unreached;
+
+            levels(cand, next);
+            bool deeper = dist[next.back()] > depth;
+            for (auto n: next)
+                dist[n] = unreached;
+            if (!deeper)
+                break;
+            root = cand;
+            nodes.swap(next);
+        }
+
+        // Cuthill-McKee: visit the neighbours by increasing degree
+        size_t first = visit.size();
+        visit.push_back(root);
+        placed[root] = true;
+        for (size_t i = first; i < visit.size(); i++) {
+            size_t added = visit.size();
+            for (size_t e = start[visit[i]]; e < start[visit[i] + 1]; e++) {
+                unsigned n = edges[e].second;
+                if (!placed[n]) {
+                    placed[n] = true;
+                    visit.push_back(n);
+                }
+            }
+            std::stable_sort(visit.begin() + added, visit.end(),
+                [&](unsigned a, unsigned b) {
+                    return degree(a) < degree(b);
+                });
+        }
+    }
+
+    std::reverse(visit.begin(), visit.end());
+    return visit;
+}
+
+void
+SparseLinearSystem::factorize()
+{
+    // LU factorisation with threshold partial pivoting. Equations are
+    // eliminated in place, so only the coefficients that fill in are
+    // added.
+    unsigned size = rows.size();
+    order = eliminationOrder();
+
+    std::vector <SparseRow> work(size);
+    // Equations that depend on each unknown, possibly already used as a
+    // pivot
+    std::vector <std::vector <unsigned>> users(size);
+    for (unsigned eq = 0; eq < size; eq++) {
+        work[eq].assign(rows[eq].begin(), rows[eq].end());
+        for (const auto &coeff: work[eq])
+            users[coeff.first].push_back(eq);
+    }
+
+    std::vector <bool> used(size, false);
+    // Position + 1 of each unknown in the equation being updated
+    std::vector <size_t> pos(size, 0);
+    // Remaining equations that depend on the current unknown, and where
+    std::vector <std::pair<unsigned, size_t>> cands;
+
+    pivots.assign(size, 0);
+    diag.assign(size, 0.0);
+    lower.clear();
+    upper.clear();
+    lowerStart.assign(1, 0);
+    upperStart.assign(1, 0);
+
+    for (unsigned step = 0; step < size; step++) {
+        unsigned unkw = order[step];
+
+        cands.clear();
+        unsigned pivot = size;
+        double largest = 0.0;
+        for (auto eq: users[unkw]) {
+            if (used[eq])
+                continue;
+            size_t i = 0;
+            while (work[eq][i].first != unkw)
+                i++;
+            cands.emplace_back(eq, i);
+            double mag = std::fabs(work[eq][i].second);
+            if (mag > largest) {
+                largest = mag;
+                pivot = eq;
+            }
+        }
+        panic_if(pivot == size, "Singular linear system:\n%s", toStr());
+
+        // Prefer the unknown's own equation unless it is much smaller
+        // than the largest coefficient, as the ordering assumes that
+        for (const auto &[eq, i]: cands) {
+            if (eq == unkw && std::fabs(work[eq][i].second) >= 0.1 * largest)
+                pivot = eq;
+        }
+
+        pivots[step] = pivot;
+        used[pivot] = true;
+        for (const auto &[c, v]: work[pivot]) {
+            if (c == unkw)
+                diag[step] = v;
+            else
+                upper.emplace_back(c, v);
+        }
+        SparseRow().swap(work[pivot]);
+        upperStart.push_back(upper.size());
+
+        // Eliminate this unknown from the rest of the equations
+        for (const auto &[eq, i]: cands) {
+            if (eq == pivot)
+                continue;
+
+            auto &row = work[eq];
+            double factor = row[i].second / diag[step];
+            row[i] = row.back();
+            row.pop_back();
+            lower.emplace_back(eq, factor);
+
+            for (size_t j = 0; j < row.size(); j++)
+                pos[row[j].first] = j + 1;
+            for (size_t u = upperStart[step]; u < upper.size(); u++) {
+                const auto &[c, v] = upper[u];
+                if (pos[c]) {
+                    row[pos[c] - 1].second -= factor * v;
+                } else {
+                    row.emplace_back(c, -factor * v);
+                    users[c].push_back(eq);
+                }
+            }
+            for (const auto &coeff: row)
+                pos[coeff.first] = 0;
+        }
+        lowerStart.push_back(lower.size());
+        std::vector <unsigned>().swap(users[unkw]);
+    }
+
+    factorized = true;
+}
+
+std::vector <double>
+SparseLinearSystem::solve(const std::vector <double> &cnt)
+{
+    assert(cnt.size() == rows.size());
+
+    if (!factorized)
+        factorize();
+
+    unsigned size = rows.size();
+
+    // Apply the elimination steps to the right hand side
+    std::vector <double> rhs(size);
+    for (unsigned eq = 0; eq < size; eq++)
+        rhs[eq] = -cnt[eq];
+    for (unsigned step = 0; step < size; step++) {
+        double p = rhs[pivots[step]];
+        for (size_t l = lowerStart[step]; l < lowerStart[step + 1]; l++)
+            rhs[lower[l].first] -= lower[l].second * p;
+    }
+
+    // And backpropagate through the pivot equations
+    std::vector <double> ret(size, 0.0);
+    for (int step = size - 1; step >= 0; step--) {
+        double v = rhs[pivots[step]];
+        for (size_t u = upperStart[step]; u < upperStart[step + 1]; u++)
+            v -= upper[u].second * ret[upper[u].first];
+        ret[order[step]] = v / diag[step];
+    }
+
+    return ret;
+}
+
 } // namespace gem5
@@ -39,8 +39,10 @@
 #define __SIM_LINEAR_SOLVER_HH__
 
 #include <cassert>
+#include <map>
 #include <sstream>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace gem5
@@ -134,6 +136,98 @@ class LinearSystem
     std::vector < LinearEquation > matrix;
 };
 
+/**
+ * A linear system that only stores its non-zero coefficients. Unlike
+ * LinearSystem, the constant terms are not part of the system: the
+ * coefficient matrix is LU-factorised once and the factorisation is
+ * reused to solve for any number of sets of constant terms. This suits
+ * models such as the thermal circuit, where the coefficients only
+ * depend on the topology of the circuit and the inputs change at every
+ * step.
+ */
+class SparseLinearSystem
+{
+  public:
+    SparseLinearSystem(unsigned unknowns = 0)
+        : rows(unknowns), factorized(false)
+    {}
+
+    unsigned size() const { return rows.size(); }
+
+    /**
+     * Add to a coefficient, this invalidates any previous factorisation.
+     *
+     * @param eq Equation to update
+     * @param unkw Unknown whose coefficient is updated
+     * @param v Value to add to the coefficient
+     */
+    void
+    add(unsigned eq, unsigned unkw, double v)
+    {
+        assert(eq < rows.size() && unkw < rows.size());
+        rows[eq][unkw] += v;
+        factorized = false;
+    }
+
+    // Get a string representation
+    std::string toStr() const;
+
+    /**
+     * Factorise the coefficient matrix. This is done by solve() if
+     * needed, but can be called upfront to keep it off the critical
+     * path.
+     */
+    void factorize();
+
+    /**
+     * Solve the system for a set of constant terms, so that for each
+     * equation i: sum(a[i][j] * x[j]) + cnt[i] = 0.
+     *
+     * @param cnt Constant term of each equation
+     * @return The value of each unknown
+     */
+    std::vector <double> solve(const std::vector <double> &cnt);
+
+    /** Number of coefficients in the factorisation, including fill */
+    size_t
+    factorSize() const
+    {
+        return diag.size() + lower.size() + upper.size();
+    }
+
+  private:
+    typedef std::vector <std::pair<unsigned, double>> SparseRow;
+
+    /**
+     * Order the unknowns are eliminated in. This is a reverse
+     * Cuthill-McKee ordering of the symmetrised coefficient pattern, so
+     * the fill does not depend on how the unknowns happen to be
+     * numbered.
+     */
+    std::vector <unsigned> eliminationOrder() const;
+
+    /** Non-zero coefficients of each equation, indexed by unknown */
+    std::vector <std::map<unsigned, double>> rows;
+
+    bool factorized;
+
+    /** Unknown eliminated at each step */
+    std::vector <unsigned> order;
+    /** Equation used as the pivot at each step */
+    std::vector <unsigned> pivots;
+    /** Multipliers (equation, factor) applied at each step to the
+     * remaining equations. Those of step k are stored from
+     * lowerStart[k] to lowerStart[k + 1] */
+    SparseRow lower;
+    std::vector <size_t> lowerStart;
+    /** Coefficients (unknown, value) of each pivot equation past its
+     * diagonal, stored like lower */
+    SparseRow upper;
+    std::vector <size_t> upperStart;
+    /** Diagonal of the factorised matrix, by step */
+    std::vector <double> diag;
+};
+
 } // namespace gem5
 
 #endif
@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "sim/linear_solver.hh"
+
+using namespace gem5;
+
+TEST(SparseLinearSystemTest, Diagonal)
+{
+    SparseLinearSystem ls(3);
+    ls.add(0, 0, 2.0);
+    ls.add(1, 1, -4.0);
+    ls.add(2, 2, 0.5);
+
+    std::vector<double> x = ls.solve({-2.0, 2.0, 1.0});
+    EXPECT_DOUBLE_EQ(1.0, x[0]);
+    EXPECT_DOUBLE_EQ(0.5, x[1]);
+    EXPECT_DOUBLE_EQ(-2.0, x[2]);
+}
+
+TEST(SparseLinearSystemTest, NeedsPivoting)
+{
+    // The first equation does not depend on x0
+    SparseLinearSystem ls(2);
+    ls.add(0, 1, 1.0);
+    ls.add(1, 0, 1.0);
+    ls.add(1, 1, 1.0);
+
+    // x1 = 3, x0 + x1 = 5
+    std::vector<double> x = ls.solve({-3.0, -5.0});
+    EXPECT_DOUBLE_EQ(2.0, x[0]);
+    EXPECT_DOUBLE_EQ(3.0, x[1]);
+}
+
+TEST(SparseLinearSystemTest, ReuseFactorization)
+{
+    SparseLinearSystem ls(2);
+    ls.add(0, 0, 1.0);
+    ls.add(0, 1, 1.0);
+    ls.add(1, 0, 1.0);
+    ls.add(1, 1, -1.0);
+    ls.factorize();
+
+    std::vector<double> x = ls.solve({-4.0, -2.0});
+    EXPECT_DOUBLE_EQ(3.0, x[0]);
+    EXPECT_DOUBLE_EQ(1.0, x[1]);
+
+    x = ls.solve({-6.0, 2.0});
+    EXPECT_DOUBLE_EQ(2.0, x[0]);
+    EXPECT_DOUBLE_EQ(4.0, x[1]);
+
+    // Changing a coefficient invalidates the factorisation
+    ls.add(1, 1, -1.0);
+    x = ls.solve({-6.0, 0.0});
+    EXPECT_DOUBLE_EQ(4.0, x[0]);
+    EXPECT_DOUBLE_EQ(2.0, x[1]);
+}
+
+TEST(SparseLinearSystemTest, MatchesDense)
+{
+    // A thermal-like grid of nodes, each connected to its neighbours
+    const unsigned side = 6;
+    const unsigned order = side * side;
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<double> dist(0.1, 2.0);
+
+    SparseLinearSystem sparse(order);
+    LinearSystem dense(order);
+    auto add = [&](unsigned eq, unsigned unkw, double v) {
+        sparse.add(eq, unkw, v);
+        dense[eq][unkw] += v;
+    };
+
+    for (unsigned i = 0; i < order; i++) {
+        add(i, i, -dist(rng));
+        if (i % side)
+            add(i, i - 1, dist(rng));
+        if (i >= side)
+            add(i, i - side, dist(rng));
+        if (i % side != side - 1)
+            add(i, i + 1, dist(rng));
+        if (i + side < order)
+            add(i, i + side, dist(rng));
+    }
+
+    for (int trial = 0; trial < 3; trial++) {
+        std::vector<double> cnt(order);
+        for (unsigned i = 0; i < order; i++) {
+            cnt[i] = dist(rng);
+            dense[i][dense[i].cnt()] = cnt[i];
+        }
+
+        std::vector<double> expected = dense.solve();
+        std::vector<double> x = sparse.solve(cnt);
+        for (unsigned i = 0; i < order; i++)
+            EXPECT_NEAR(expected[i], x[i], 1e-6 * std::abs(expected[i]));
+    }
+}
+
+TEST(SparseLinearSystemTest, LargeShuffledGrid)
+{
+    // The fill must not depend on how the nodes are numbered: a grid with
+    // shuffled ids used to factorise to millions of coefficients
+    const unsigned side = 60;
+    const unsigned order = side * side;
+
+    std::vector<unsigned> id(order);
+    for (unsigned i = 0; i < order; i++)
+        id[i] = i;
+    std::mt19937 rng(1);
+    std::shuffle(id.begin(), id.end(), rng);
+    std::uniform_real_distribution<double> dist(0.1, 2.0);
+
+    SparseLinearSystem ls(order);
+    std::vector<std::tuple<unsigned, unsigned, double>> coeffs;
+    auto add = [&](unsigned eq, unsigned unkw, double v) {
+        ls.add(id[eq], id[unkw], v);
+        coeffs.emplace_back(id[eq], id[unkw], v);
+    };
+
+    for (unsigned i = 0; i < order; i++) {
+        // Resistors to the neighbours and to a reference
+        add(i, i, -dist(rng));
+        auto link = [&](unsigned j) {
+            double g = dist(rng);
+            add(i, i, -g);
+            add(i, j, g);
+        };
+        if (i % side)
+            link(i - 1);
+        if (i >= side)
+            link(i - side);
+        if (i % side != side - 1)
+            link(i + 1);
+        if (i + side < order)
+            link(i + side);
+    }
+
+    ls.factorize();
+    // No more than eliminating the grid row by row, as a band matrix
+    EXPECT_LT(ls.factorSize(), order * (2 * side + 1));
+
+    std::vector<double> cnt(order);
+    for (auto &c: cnt)
+        c = dist(rng);
+    std::vector<double> x = ls.solve(cnt);
+
+    std::vector<double> residual = cnt;
+    for (const auto &[eq, unkw, v]: coeffs)
+        residual[eq] += v * x[unkw];
+    for (unsigned i = 0; i < order; i++)
+        EXPECT_NEAR(0.0, residual[i], 1e-9);
+}
@@ -191,4 +191,80 @@ MathExpr::getVariables(const Node *n,
     }
 }
 
+MathExpr::Program
+MathExpr::compile() const
+{
+    Program prog;
+    compile(root, prog, 1);
+    return prog;
+}
+
+void
+MathExpr::compile(const Node *n, Program &prog, unsigned depth) const
+{
+    if (prog.stack.size() < depth)
+        prog.stack.resize(depth);
+
+    if (!n) {
+        prog.code.push_back({sValue, nullptr, 0, 0});
+        return;
+    }
+
+    switch (n->op) {
+      case sValue:
+        prog.code.push_back({sValue, nullptr, n->value, 0});
+        break;
+      case sVariable:
+        {
+            auto &vars = prog.variables;
+            auto it = std::find(vars.begin(), vars.end(), n->variable);
+            unsigned idx = it - vars.begin();
+            if (it == vars.end())
+                vars.push_back(n->variable);
+            prog.code.push_back({sVariable, nullptr, 0, idx});
+        }
+        break;
+      case uNeg:
+        compile(n->r, prog, depth);
+        prog.code.push_back({uNeg, nullptr, 0, 0});
+        break;
+      case nInvalid:
+        panic("Cannot compile an invalid expression node\n");
+      default:
+        {
+            auto opt = std::find_if(ops.begin(), ops.end(),
+                [n](const OpSearch &o) { return o.op == n->op; });
+            panic_if(opt == ops.end(), "Invalid node!\n");
+            compile(n->l, prog, depth);
+            compile(n->r, prog, depth + 1);
+            prog.code.push_back({n->op, opt->fn, 0, 0});
+        }
+        break;
+    }
+}
+
+double
+MathExpr::Program::eval(const double *values) const
+{
+    double *top = stack.data() - 1;
+    for (const Instr &i : code) {
+        switch (i.op) {
+          case sValue:
+            *++top = i.value;
+            break;
+          case sVariable:
+            *++top = values[i.var];
+            break;
+          case uNeg:
+            *top = -*top;
+            break;
+          default:
+            --top;
+            *top = i.fn(top[0], top[1]);
+            break;
+        }
+    }
+    return *top;
+}
+
 } // namespace gem5
@@ -87,6 +87,17 @@ class MathExpr
         return vars;
     }
 
+    class Program;
+
+    /**
+     * Flatten the expression tree into a postfix program. The program
+     * numbers each distinct variable so that callers can resolve them
+     * once and evaluate without a callback or any string lookups.
+     *
+     * @return A program that evaluates to the same value as the tree
+     */
+    Program compile() const;
+
   private:
     enum Operator
     {
@@ -147,6 +158,57 @@ class MathExpr
     /** Return all variable reachable from a node to a vector of
      * strings */
     void getVariables(const Node *n, std::vector<std::string> &vars) const;
+
+    /** Append the postfix code for a node to a program */
+    void compile(const Node *n, Program &prog, unsigned depth) const;
+};
+
+/**
+ * A MathExpr compiled into a flat sequence of stack operations. It does
+ * not reference the tree it was built from, so it is cheap to evaluate
+ * repeatedly and safe to keep after the expression goes away.
+ */
+class MathExpr::Program
+{
+  public:
+    /**
+     * Names of the variables used by the program. The value of
+     * variable i is passed as values[i] to eval().
+     */
+    const std::vector<std::string> &
+    getVariables() const
+    {
+        return variables;
+    }
+
+    /**
+     * Evaluates the program
+     *
+     * @param values The value of each variable, in getVariables() order
+     *
+     * @return The value for this expression
+     */
+    double eval(const double *values) const;
+
+  private:
+    friend class MathExpr;
+
+    struct Instr
+    {
+        Operator op;
+        /** Operator function for binary operations */
+        binOp fn;
+        /** Constant for sValue */
+        double value;
+        /** Variable index for sVariable */
+        unsigned var;
+    };
+
+    std::vector<Instr> code;
+    std::vector<std::string> variables;
+
+    /** Evaluation stack, sized to the deepest point in the program */
+    mutable std::vector<double> stack;
 };
 
 } // namespace gem5
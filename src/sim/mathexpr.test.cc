@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 The gem5 Authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "sim/mathexpr.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+std::map<std::string, double> vars = {
+    {"a", 2.0}, {"b", 3.0}, {"c", -1.5}, {"x.y", 0.25},
+};
+
+double
+lookup(std::string name)
+{
+    return vars.at(name);
+}
+
+/** Evaluate a compiled expression with values taken from vars */
+double
+runProgram(const MathExpr &expr)
+{
+    MathExpr::Program prog = expr.compile();
+    std::vector<double> values;
+    for (const auto &name : prog.getVariables())
+        values.push_back(vars.at(name));
+    return prog.eval(values.data());
+}
+
+} // anonymous namespace
+
+TEST(MathExprTest, Eval)
+{
+    EXPECT_DOUBLE_EQ(14.0, MathExpr("2+3*4").eval(lookup));
+    EXPECT_DOUBLE_EQ(20.0, MathExpr("(2+3)*4").eval(lookup));
+    EXPECT_DOUBLE_EQ(-1.0, MathExpr("a-b").eval(lookup));
+    EXPECT_DOUBLE_EQ(8.0, MathExpr("a^b").eval(lookup));
+}
+
+TEST(MathExprTest, CompileMatchesEval)
+{
+    const std::vector<std::string> exprs = {
+        "1", "a", "-a", "a+b*c", "(a+b)*c", "a-b-c", "a/b/c", "a^b",
+        "-(a+b)^2", "a*-b", "x.y*(a+2.5)/(b-c)", "a*a+b*b-c/a",
+        "2*a^2+-c*(b-x.y)",
+    };
+
+    for (const auto &s : exprs) {
+        MathExpr expr(s);
+        EXPECT_DOUBLE_EQ(expr.eval(lookup), runProgram(expr)) << s;
+    }
+}
+
+TEST(MathExprTest, CompileVariables)
+{
+    MathExpr expr("a*b+a*c-b");
+    MathExpr::Program prog = expr.compile();
+
+    // Each variable appears once, in order of first use
+    EXPECT_EQ(std::vector<std::string>({"a", "b", "c"}),
+              prog.getVariables());
+
+    double values[] = {1.0, 2.0, 4.0};
+    EXPECT_DOUBLE_EQ(4.0, prog.eval(values));
+
+    // The program is independent of the expression it came from
+    values[2] = 0.5;
+    EXPECT_DOUBLE_EQ(0.5, prog.eval(values));
+}
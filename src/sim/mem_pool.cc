@@ -151,6 +151,7 @@ MemPools::populate(const AddrRangeList &memories)
 Addr
 MemPools::allocPhysPages(int npages, int pool_id)
 {
+    std::lock_guard<std::mutex> lock(mutex);
     return pools[pool_id].allocate(npages);
 }
 
@@ -163,6 +164,7 @@ MemPools::memSize(int pool_id) const
 Addr
 MemPools::freeMemSize(int pool_id) const
 {
+    std::lock_guard<std::mutex> lock(mutex);
     return pools[pool_id].freeBytes();
 }
 
@@ -32,6 +32,7 @@
 #ifndef __MEM_POOL_HH__
 #define __MEM_POOL_HH__
 
+#include <mutex>
 #include <vector>
 
 #include "base/addr_range.hh"
@@ -90,6 +91,12 @@ class MemPools : public Serializable
 
     std::vector<MemPool> pools;
 
+    /**
+     * Processes running on different event queues allocate pages
+     * concurrently.
+     */
+    mutable std::mutex mutex;
+
   public:
     MemPools(Addr page_shift) : pageShift(page_shift) {}
 
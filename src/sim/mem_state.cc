@@ -29,6 +29,7 @@
 #include "sim/mem_state.hh"
 
 #include <cassert>
+#include <vector>
 
 #include "arch/generic/mmu.hh"
 #include "debug/Vma.hh"
@@ -94,7 +95,7 @@ MemState::isUnmapped(Addr start_addr, Addr length)
      */
     for (auto start = start_addr; start < end_addr;
          start += _pageBytes) {
-        if (_ownerProcess->pTable->lookup(start) != nullptr) {
+        if (_ownerProcess->pTable->lookup(start)) {
             panic("Someone allocated physical memory at VA %p without "
                   "creating a VMA!\n", start);
             return false;
@@ -409,13 +410,21 @@ MemState::fixupFault(Addr vaddr)
             if (vma.hasHostBuf()) {
                 /**
                  * Write the memory for the host buffer contents for all
-                 * ThreadContexts associated with this process.
+                 * ThreadContexts associated with this process. If the
+                 * page can be written to directly through a memory back
+                 * door, there is nothing on the way to the memory to
+                 * update, and writing it once is enough.
                  */
+                std::vector<struct iovec> iov;
                 for (auto &cid : _ownerProcess->contextIds) {
                     auto *tc = _ownerProcess->system->threads[cid];
                     SETranslatingPortProxy
                         virt_mem(tc, SETranslatingPortProxy::Always);
                     vma.fillMemPages(vpage_start, _pageBytes, virt_mem);
+                    if (virt_mem.tryHostRanges(
+                                vpage_start, _pageBytes, true, iov)) {
+                        break;
+                    }
                 }
             }
             return true;
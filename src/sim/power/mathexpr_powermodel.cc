@@ -49,7 +49,7 @@ namespace gem5
 {
 
 MathExprPowerModel::MathExprPowerModel(const Params &p)
-    : PowerModelState(p), dyn_expr(p.dyn), st_expr(p.st)
+    : PowerModelState(p), dyn_expr(p.dyn), st_expr(p.st), compiled(false)
 {
 }
 
@@ -71,6 +71,72 @@ MathExprPowerModel::startup()
             statsMap[var] = info;
         }
     }
+
+    dyn_prog = compile(dyn_expr);
+    st_prog = compile(st_expr);
+    compiled = true;
+}
+
+MathExprPowerModel::CompiledExpr
+MathExprPowerModel::compile(const MathExpr &expr) const
+{
+    using namespace statistics;
+
+    CompiledExpr c{expr.compile(), {}, {}};
+
+    for (const auto &var: c.program.getVariables()) {
+        Operand op{Operand::Temp, nullptr, nullptr};
+        if (var == "temp") {
+            op.kind = Operand::Temp;
+        } else if (var == "voltage") {
+            op.kind = Operand::Voltage;
+        } else if (var == "clock_period") {
+            op.kind = Operand::ClockPeriod;
+        } else {
+            const Info *info = statsMap.at(var);
+            // Try to cast the stat, only these are supported right now
+            op.scalar = dynamic_cast<const ScalarInfo *>(info);
+            op.formula = dynamic_cast<const FormulaInfo *>(info);
+            if (op.scalar) {
+                op.kind = Operand::Scalar;
+            } else if (op.formula) {
+                op.kind = Operand::Formula;
+            } else {
+                fatal("Unsupported type for stat %s in expression:\n%s\n",
+                      var, expr.toStr());
+            }
+        }
+        c.operands.push_back(op);
+    }
+    c.values.resize(c.operands.size());
+
+    return c;
+}
+
+double
+MathExprPowerModel::eval(const CompiledExpr &expr) const
+{
+    for (size_t i = 0; i < expr.operands.size(); ++i) {
+        const Operand &op = expr.operands[i];
+        switch (op.kind) {
+          case Operand::Temp:
+            expr.values[i] = _temp.toCelsius();
+            break;
+          case Operand::Voltage:
+            expr.values[i] = clocked_object->voltage();
+            break;
+          case Operand::ClockPeriod:
+            expr.values[i] = clocked_object->clockPeriod();
+            break;
+          case Operand::Scalar:
+            expr.values[i] = op.scalar->value();
+            break;
+          case Operand::Formula:
+            expr.values[i] = op.formula->total();
+            break;
+        }
+    }
+    return expr.program.eval(expr.values.data());
 }
 
 double
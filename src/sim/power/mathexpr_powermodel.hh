@@ -50,6 +50,8 @@ namespace gem5
 namespace statistics
 {
     class Info;
+    class ScalarInfo;
+    class FormulaInfo;
 }
 
 /**
@@ -68,14 +70,20 @@ class MathExprPowerModel : public PowerModelState
      *
      * @return Power (Watts) consumed by this object (dynamic component)
      */
-    double getDynamicPower() const override { return eval(dyn_expr); }
+    double getDynamicPower() const override
+    {
+        return compiled ? eval(dyn_prog) : eval(dyn_expr);
+    }
 
     /**
      * Get the static power consumption.
      *
      * @return Power (Watts) consumed by this object (static component)
      */
-    double getStaticPower() const override { return eval(st_expr); }
+    double getStaticPower() const override
+    {
+        return compiled ? eval(st_prog) : eval(st_expr);
+    }
 
     /**
      * Get the value for a variable (maps to a stat)
@@ -90,6 +98,45 @@ class MathExprPowerModel : public PowerModelState
     void regStats() override;
 
   private:
+    /** Where the value of a variable in a compiled expression comes from */
+    struct Operand
+    {
+        enum Kind { Temp, Voltage, ClockPeriod, Scalar, Formula };
+
+        Kind kind;
+        const statistics::ScalarInfo *scalar;
+        const statistics::FormulaInfo *formula;
+    };
+
+    /**
+     * An expression compiled at startup together with the resolved
+     * sources of its variables, so that evaluating it needs neither
+     * string lookups nor dynamic casts.
+     */
+    struct CompiledExpr
+    {
+        MathExpr::Program program;
+        std::vector<Operand> operands;
+        mutable std::vector<double> values;
+    };
+
+    /**
+     * Compile an expression and resolve its variables, fatal if a
+     * variable does not name a supported stat.
+     *
+     * @param expr Expression to compile
+     * @return The compiled expression
+     */
+    CompiledExpr compile(const MathExpr &expr) const;
+
+    /**
+     * Evaluate a compiled expression in the context of this object.
+     *
+     * @param expr Compiled expression to evaluate
+     * @return Value of expression.
+     */
+    double eval(const CompiledExpr &expr) const;
+
     /**
      * Evaluate an expression in the context of this object, fatal if
      * evaluation fails.
@@ -102,6 +149,10 @@ class MathExprPowerModel : public PowerModelState
     // Math expressions for dynamic and static power
     MathExpr dyn_expr, st_expr;
 
+    // Compiled forms of the expressions, valid once compiled is set
+    CompiledExpr dyn_prog, st_prog;
+    bool compiled;
+
     // Map that contains relevant stats for this power model
     std::unordered_map<std::string, const statistics::Info*> statsMap;
 };
@@ -93,4 +93,14 @@ ThermalDomain::getEquation(ThermalNode * tn, unsigned n, double step) const
     return eq;
 }
 
+void
+ThermalDomain::addConstants(std::vector<double> &cnt,
+                            const std::vector<ThermalNode *> &nodes,
+                            double step) const
+{
+    if (!node->isref)
+        cnt[node->id] += subsystem->getDynamicPower() +
+            subsystem->getStaticPower();
+}
+
 } // namespace gem5
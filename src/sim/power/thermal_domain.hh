@@ -83,9 +83,16 @@ class ThermalDomain : public SimObject, public ThermalEntity
     void setNode(ThermalNode * n) { node = n; }
     ThermalNode * getNode() const { return node; }
 
-    /** Get nodal equation imposed by this node */
+    /** Get nodal equation imposed by this node, the domain only adds
+     * its power to the constant term */
     LinearEquation getEquation(ThermalNode * tn, unsigned n,
                                double step) const override;
+    void addCoefficients(SparseLinearSystem &ls,
+                         const std::vector<ThermalNode *> &nodes,
+                         double step) const override {}
+    void addConstants(std::vector<double> &cnt,
+                      const std::vector<ThermalNode *> &nodes,
+                      double step) const override;
 
     /**
       *  Emit a temperature update through probe points interface
@@ -38,12 +38,15 @@
 #ifndef __SIM_THERMAL_ENTITY_HH__
 #define __SIM_THERMAL_ENTITY_HH__
 
+#include <vector>
+
 #include "sim/sim_object.hh"
 
 namespace gem5
 {
 
 class LinearEquation;
+class SparseLinearSystem;
 class ThermalNode;
 
 /**
@@ -57,6 +60,25 @@ class ThermalEntity
     // Get the equation given a node and a step in seconds (assuming N nodes)
     virtual LinearEquation getEquation(ThermalNode *tn, unsigned n,
                                        double step) const = 0;
+
+    /**
+     * Add this entity's contribution to the coefficients of the nodal
+     * equations of the non-reference nodes. ThermalModel only does
+     * this once, so the coefficients must not change over time. The
+     * default implementation builds the full equation of every node.
+     */
+    virtual void addCoefficients(SparseLinearSystem &ls,
+                                 const std::vector<ThermalNode *> &nodes,
+                                 double step) const;
+
+    /**
+     * Add this entity's contribution to the constant terms of the
+     * nodal equations, this is done at every step. The default
+     * implementation builds the full equation of every node.
+     */
+    virtual void addConstants(std::vector<double> &cnt,
+                              const std::vector<ThermalNode *> &nodes,
+                              double step) const;
 };
 
 } // namespace gem5
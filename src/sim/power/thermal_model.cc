@@ -65,6 +65,20 @@ ThermalReference::getEquation(ThermalNode * n, unsigned nnodes,
     return LinearEquation(nnodes);
 }
 
+void
+ThermalReference::addCoefficients(SparseLinearSystem &ls,
+                                  const std::vector<ThermalNode *> &nodes,
+                                  double step) const
+{
+}
+
+void
+ThermalReference::addConstants(std::vector<double> &cnt,
+                               const std::vector<ThermalNode *> &nodes,
+                               double step) const
+{
+}
+
 /**
  * ThermalResistor
  */
@@ -100,6 +114,36 @@ ThermalResistor::getEquation(ThermalNode * n, unsigned nnodes,
     return eq;
 }
 
+void
+ThermalResistor::addCoefficients(SparseLinearSystem &ls,
+                                 const std::vector<ThermalNode *> &nodes,
+                                 double step) const
+{
+    // Same as getEquation(), for the equation of each end
+    const std::pair<ThermalNode *, ThermalNode *> ends[] = {
+        {node1, node2}, {node2, node1}};
+    for (auto [n, other] : ends) {
+        if (n->isref)
+            continue;
+        ls.add(n->id, n->id, -1.0 / _resistance);
+        if (!other->isref)
+            ls.add(n->id, other->id, 1.0 / _resistance);
+    }
+}
+
+void
+ThermalResistor::addConstants(std::vector<double> &cnt,
+                              const std::vector<ThermalNode *> &nodes,
+                              double step) const
+{
+    const std::pair<ThermalNode *, ThermalNode *> ends[] = {
+        {node1, node2}, {node2, node1}};
+    for (auto [n, other] : ends) {
+        if (!n->isref && other->isref)
+            cnt[n->id] += other->temp.toKelvin() / _resistance;
+    }
+}
+
 /**
  * ThermalCapacitor
  */
@@ -139,6 +183,40 @@ ThermalCapacitor::getEquation(ThermalNode * n, unsigned nnodes,
     return eq;
 }
 
+void
+ThermalCapacitor::addCoefficients(SparseLinearSystem &ls,
+                                  const std::vector<ThermalNode *> &nodes,
+                                  double step) const
+{
+    // Same as getEquation(), for the equation of each end
+    const std::pair<ThermalNode *, ThermalNode *> ends[] = {
+        {node1, node2}, {node2, node1}};
+    for (auto [n, other] : ends) {
+        if (n->isref)
+            continue;
+        ls.add(n->id, n->id, -_capacitance / step);
+        if (!other->isref)
+            ls.add(n->id, other->id, _capacitance / step);
+    }
+}
+
+void
+ThermalCapacitor::addConstants(std::vector<double> &cnt,
+                               const std::vector<ThermalNode *> &nodes,
+                               double step) const
+{
+    const std::pair<ThermalNode *, ThermalNode *> ends[] = {
+        {node1, node2}, {node2, node1}};
+    for (auto [n, other] : ends) {
+        if (n->isref)
+            continue;
+        double prev = (n->temp - other->temp).toKelvin();
+        if (other->isref)
+            prev += other->temp.toKelvin();
+        cnt[n->id] += _capacitance / step * prev;
+    }
+}
+
 /**
  * ThermalModel
  */
@@ -151,20 +229,14 @@ void
 ThermalModel::doStep()
 {
     // Calculate new temperatures!
-    // For each node in the system, create the kirchhoff nodal equation
-    LinearSystem ls(eq_nodes.size());
-    for (unsigned i = 0; i < eq_nodes.size(); i++) {
-        auto n = eq_nodes[i];
-        LinearEquation node_equation (eq_nodes.size());
-        for (auto e : entities) {
-            LinearEquation eq = e->getEquation(n, eq_nodes.size(), _step);
-            node_equation = node_equation + eq;
-        }
-        ls[i] = node_equation;
-    }
+    // The coefficients of the kirchhoff nodal equations are fixed, so
+    // only gather the constant terms (powers and past temperatures)
+    std::vector <double> cnt(eq_nodes.size(), 0.0);
+    for (auto e : entities)
+        e->addConstants(cnt, eq_nodes, _step);
 
     // Get temperatures for this iteration
-    std::vector <double> temps = ls.solve();
+    std::vector <double> temps = eq_system.solve(cnt);
     for (unsigned i = 0; i < eq_nodes.size(); i++)
         eq_nodes[i]->temp = Temperature::fromKelvin(temps[i]);
 
@@ -205,6 +277,13 @@ ThermalModel::startup()
     for (unsigned i = 0; i < eq_nodes.size(); i++)
         eq_nodes[i]->id = i;
 
+    // Build and factorise the nodal equations, they only depend on the
+    // circuit and the step
+    eq_system = SparseLinearSystem(eq_nodes.size());
+    for (auto e : entities)
+        e->addCoefficients(eq_system, eq_nodes, _step);
+    eq_system.factorize();
+
     // Schedule first thermal update
     schedule(stepEvent, curTick() + sim_clock::as_int::s * _step);
 }
@@ -42,6 +42,7 @@
 
 #include "base/temperature.hh"
 #include "sim/clocked_object.hh"
+#include "sim/linear_solver.hh"
 #include "sim/power/thermal_domain.hh"
 #include "sim/power/thermal_entity.hh"
 #include "sim/power/thermal_node.hh"
@@ -73,6 +74,12 @@ class ThermalResistor : public SimObject, public ThermalEntity
 
     LinearEquation getEquation(ThermalNode * tn, unsigned n,
                                double step) const override;
+    void addCoefficients(SparseLinearSystem &ls,
+                         const std::vector<ThermalNode *> &nodes,
+                         double step) const override;
+    void addConstants(std::vector<double> &cnt,
+                      const std::vector<ThermalNode *> &nodes,
+                      double step) const override;
 
   private:
     /* Resistance value in K/W */
@@ -94,6 +101,12 @@ class ThermalCapacitor : public SimObject, public ThermalEntity
 
     LinearEquation getEquation(ThermalNode * tn, unsigned n,
                                double step) const override;
+    void addCoefficients(SparseLinearSystem &ls,
+                         const std::vector<ThermalNode *> &nodes,
+                         double step) const override;
+    void addConstants(std::vector<double> &cnt,
+                      const std::vector<ThermalNode *> &nodes,
+                      double step) const override;
 
     void setNodes(ThermalNode * n1, ThermalNode * n2) {
         node1 = n1;
@@ -125,6 +138,12 @@ class ThermalReference : public SimObject, public ThermalEntity
 
     LinearEquation getEquation(ThermalNode * tn, unsigned n,
                                double step) const override;
+    void addCoefficients(SparseLinearSystem &ls,
+                         const std::vector<ThermalNode *> &nodes,
+                         double step) const override;
+    void addConstants(std::vector<double> &cnt,
+                      const std::vector<ThermalNode *> &nodes,
+                      double step) const override;
 
     /* Fixed temperature value */
     const Temperature _temperature;
@@ -173,6 +192,9 @@ class ThermalModel : public ClockedObject
     std::vector <ThermalNode*> nodes;
     std::vector <ThermalNode*> eq_nodes;
 
+    /* Nodal equations, only their constant terms change between steps */
+    SparseLinearSystem eq_system;
+
     /** Stepping event to update the model values */
     EventFunctionWrapper stepEvent;
 
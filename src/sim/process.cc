@@ -130,6 +130,8 @@ Process::Process(const ProcessParams &params, EmulationPageTable *pTable,
       _pgid(params.pgid), drivers(params.drivers),
       fds(std::make_shared<FDArray>(
                   params.input, params.output, params.errout)),
+      asyncIO(params.async_io_threads ?
+              std::make_shared<AsyncIO>(params.async_io_threads) : nullptr),
       childClearTID(0),
       ADD_STAT(numSyscalls, statistics::units::Count::get(),
                "Number of system calls")
@@ -137,6 +139,7 @@ Process::Process(const ProcessParams &params, EmulationPageTable *pTable,
     fatal_if(!seWorkload, "Couldn't find appropriate workload object.");
     fatal_if(_pid >= System::maxPID, "_pid is too large: %d", _pid);
 
+    std::lock_guard<std::recursive_mutex> lock(system->processLock);
     auto ret_pair = system->PIDs.emplace(_pid);
     fatal_if(!ret_pair.second, "_pid %d is already used", _pid);
 
@@ -207,6 +210,8 @@ Process::clone(ThreadContext *otc, ThreadContext *ntc,
         *np->memState = *memState;
     }
 
+    np->asyncIO = asyncIO;
+
     if (CLONE_FILES & flags) {
         /**
          * The parent and child file descriptors are shared because the
@@ -328,7 +333,7 @@ Process::allocateMem(Addr vaddr, int64_t size, bool clobber)
     // a physical page frame to map with the virtual page. Other cores can
     // return if the page has been mapped and `!clobber`.
     if (!clobber) {
-        const EmulationPageTable::Entry *pte = pTable->lookup(page_addr);
+        auto pte = pTable->lookup(page_addr);
         if (pte) {
             warn("Process::allocateMem: addr %#x already mapped\n", vaddr);
             return;
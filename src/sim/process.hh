@@ -41,6 +41,7 @@
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "mem/se_translating_port_proxy.hh"
+#include "sim/async_io.hh"
 #include "sim/fd_array.hh"
 #include "sim/fd_entry.hh"
 #include "sim/mem_state.hh"
@@ -285,6 +286,9 @@ class Process : public SimObject
 
     std::shared_ptr<FDArray> fds;
 
+    // Host threads running file I/O syscalls, if asynchronous
+    std::shared_ptr<AsyncIO> asyncIO;
+
     bool *exitGroup;
     std::shared_ptr<MemState> memState;
 
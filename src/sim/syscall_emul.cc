@@ -29,9 +29,12 @@
 #include "sim/syscall_emul.hh"
 
 #include <fcntl.h>
+#include <sys/stat.h>
 #include <sys/syscall.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <climits>
 #include <csignal>
 #include <iostream>
 #include <mutex>
@@ -61,6 +64,96 @@ warnUnsupportedOS(std::string syscall_name)
     warn("Cannot invoke %s on host operating system.", syscall_name);
 }
 
+bool
+hostBuffer(ThreadContext *tc, Addr addr, uint64_t size, bool write,
+           std::vector<struct iovec> &iov)
+{
+    // Writes may grow the stack, as when copying a BufferArg out.
+    SETranslatingPortProxy proxy(tc);
+    return proxy.tryHostRanges(addr, size, write, iov) &&
+        iov.size() <= IOV_MAX;
+}
+
+SyscallReturn
+asyncFileIO(ThreadContext *tc, Addr addr, uint64_t size, bool to_target,
+            AsyncIO::Operation op)
+{
+    auto &async_io = tc->getProcessPtr()->asyncIO;
+    const ContextID id = tc->contextId();
+
+    if (auto req = async_io->find(id)) {
+        if (!req->done.load(std::memory_order_acquire))
+            return SyscallReturn::retry();
+
+        const int64_t result = req->result;
+        if (to_target && result > 0) {
+            SETranslatingPortProxy(tc).writeBlob(
+                    addr, req->buffer.data(), result);
+        }
+        async_io->retire(id);
+        return result;
+    }
+
+    std::vector<uint8_t> buffer(size);
+    if (!to_target)
+        SETranslatingPortProxy(tc).readBlob(addr, buffer.data(), size);
+    async_io->issue(id, std::move(buffer), std::move(op));
+    return SyscallReturn::retry();
+}
+
+SyscallReturn
+asyncFileSeqIO(ThreadContext *tc, int sim_fd, Addr addr, uint64_t size,
+               bool to_target)
+{
+    // Collect the result of an operation issued by an earlier attempt.
+    if (tc->getProcessPtr()->asyncIO->find(tc->contextId()))
+        return asyncFileIO(tc, addr, size, to_target, nullptr);
+
+    // Reserve the bytes accessed at the current file offset right away,
+    // so that the operation is ordered against the other (synchronous or
+    // asynchronous) accesses to the file as the system calls are.
+    off_t offset;
+    if (to_target) {
+        struct stat st;
+        offset = lseek(sim_fd, 0, SEEK_CUR);
+        if (offset == -1 || fstat(sim_fd, &st) == -1)
+            return -errno;
+        // Reads stop at the end of the file.
+        size = std::min<uint64_t>(size, std::max<off_t>(
+                    st.st_size - offset, 0));
+        lseek(sim_fd, offset + size, SEEK_SET);
+    } else {
+        offset = lseek(sim_fd, size, SEEK_CUR);
+        if (offset == -1)
+            return -errno;
+        offset -= size;
+    }
+
+    if (to_target) {
+        return asyncFileIO(tc, addr, size, true,
+            [sim_fd, offset](std::vector<uint8_t> &buf) -> int64_t {
+                auto ret = pread(sim_fd, buf.data(), buf.size(), offset);
+                return (ret == -1) ? -errno : ret;
+            });
+    } else {
+        return asyncFileIO(tc, addr, size, false,
+            [sim_fd, offset](std::vector<uint8_t> &buf) -> int64_t {
+                auto ret = pwrite(sim_fd, buf.data(), buf.size(), offset);
+                if (ret == -1)
+                    return -errno;
+                fsync(sim_fd);
+                return ret;
+            });
+    }
+}
+
+bool
+isRegularFile(int sim_fd)
+{
+    struct stat st;
+    return fstat(sim_fd, &st) == 0 && S_ISREG(st.st_mode);
+}
+
 SyscallReturn
 unimplementedFunc(SyscallDesc *desc, ThreadContext *tc)
 {
@@ -180,6 +273,7 @@ exitImpl(SyscallDesc *desc, ThreadContext *tc, bool group, int status)
     if (last_thread) {
         if (parent) {
             assert(tg_lead);
+            std::lock_guard<std::recursive_mutex> lock(sys->processLock);
             sys->signalList.push_back(BasicSignal(tg_lead, parent, SIGCHLD));
         }
 
@@ -85,6 +85,7 @@
 #include <cerrno>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arch/generic/tlb.hh"
 #include "base/intmath.hh"
@@ -99,6 +100,7 @@
 #include "mem/page_table.hh"
 #include "mem/se_translating_port_proxy.hh"
 #include "params/Process.hh"
+#include "sim/async_io.hh"
 #include "sim/emul_driver.hh"
 #include "sim/futex_map.hh"
 #include "sim/guest_abi.hh"
@@ -128,6 +130,47 @@ namespace gem5
 
 void warnUnsupportedOS(std::string syscall_name);
 
+/**
+ * Get the host memory backing a buffer in target memory, so that host
+ * system calls can access it in place instead of through a copy.
+ *
+ * @param write Whether the system call writes to the buffer.
+ * @param iov The host memory ranges of the buffer.
+ * @return Whether the whole buffer can be accessed in place.
+ */
+bool hostBuffer(ThreadContext *tc, Addr addr, uint64_t size, bool write,
+                std::vector<struct iovec> &iov);
+
+/**
+ * Run a host file I/O operation on the asynchronous I/O threads of the
+ * process, through a copy of a buffer in target memory. The operation is
+ * issued by the first call, and the system call is retried (with the
+ * thread context suspended) until it has completed.
+ *
+ * @param to_target Whether the operation fills the buffer, which is then
+ *                  copied to target memory, rather than reads it.
+ */
+SyscallReturn asyncFileIO(ThreadContext *tc, Addr addr, uint64_t size,
+                          bool to_target, AsyncIO::Operation op);
+
+/**
+ * Asynchronously read or write a buffer at the current offset of a host
+ * file, like read and write. The offset is updated when the operation
+ * is issued, and the worker accesses the file with pread or pwrite, so
+ * that the operation is ordered against the other accesses to the file
+ * as the system call is. Files opened with O_APPEND must be written
+ * synchronously instead.
+ */
+SyscallReturn asyncFileSeqIO(ThreadContext *tc, int sim_fd, Addr addr,
+                             uint64_t size, bool to_target);
+
+/**
+ * Whether a host file descriptor refers to a regular file. Only those are
+ * accessed asynchronously, since I/O on terminals, pipes, sockets or
+ * devices may block the asynchronous I/O threads indefinitely.
+ */
+bool isRegularFile(int sim_fd);
+
 /// Handler for unimplemented syscalls that we haven't thought about.
 SyscallReturn unimplementedFunc(SyscallDesc *desc, ThreadContext *tc);
 
@@ -1213,6 +1256,7 @@ pollFunc(SyscallDesc *desc, ThreadContext *tc,
              * to return the signal interrupt instead.
              */
             System *sysh = tc->getSystemPtr();
+            std::lock_guard<std::recursive_mutex> lock(sysh->processLock);
             std::list<BasicSignal>::iterator it;
             for (it=sysh->signalList.begin(); it!=sysh->signalList.end(); it++)
                 if (it->receiver == p)
@@ -1644,6 +1688,9 @@ doClone(SyscallDesc *desc, ThreadContext *tc, RegVal flags, RegVal newStack,
     pp->egid = p->egid();
     pp->release = p->release;
 
+    // Hold the lock until the new process has taken the PID.
+    std::unique_lock<std::recursive_mutex> pids_lock(p->system->processLock);
+
     /* Find the first free PID that's less than the maximum */
     std::set<int> const& pids = p->system->PIDs;
     int temp_pid = *pids.begin();
@@ -1658,6 +1705,7 @@ doClone(SyscallDesc *desc, ThreadContext *tc, RegVal flags, RegVal newStack,
     pp->useArchPT = p->useArchPT;
     pp->kvmInSE = p->kvmInSE;
     Process *cp = pp->create();
+    pids_lock.unlock();
     // TODO: there is no way to know when the Process SimObject is done with
     // the params pointer. Both the params pointer (pp) and the process
     // pointer (cp) are normally managed in python and are never cleaned up.
@@ -2001,6 +2049,20 @@ pread64Func(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = ffdp->getSimFD();
 
+    if (p->asyncIO && isRegularFile(sim_fd)) {
+        return asyncFileIO(tc, bufPtr, nbytes, true,
+            [sim_fd, offset](std::vector<uint8_t> &buf) -> int64_t {
+                auto ret = pread(sim_fd, buf.data(), buf.size(), offset);
+                return (ret == -1) ? -errno : ret;
+            });
+    }
+
+    std::vector<struct iovec> iov;
+    if (hostBuffer(tc, bufPtr, nbytes, true, iov)) {
+        int bytes_read = preadv(sim_fd, iov.data(), iov.size(), offset);
+        return (bytes_read == -1) ? -errno : bytes_read;
+    }
+
     BufferArg bufArg(bufPtr, nbytes);
 
     int bytes_read = pread(sim_fd, bufArg.bufferPtr(), nbytes, offset);
@@ -2022,6 +2084,20 @@ pwrite64Func(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = ffdp->getSimFD();
 
+    if (p->asyncIO && isRegularFile(sim_fd)) {
+        return asyncFileIO(tc, bufPtr, nbytes, false,
+            [sim_fd, offset](std::vector<uint8_t> &buf) -> int64_t {
+                auto ret = pwrite(sim_fd, buf.data(), buf.size(), offset);
+                return (ret == -1) ? -errno : ret;
+            });
+    }
+
+    std::vector<struct iovec> iov;
+    if (hostBuffer(tc, bufPtr, nbytes, false, iov)) {
+        int bytes_written = pwritev(sim_fd, iov.data(), iov.size(), offset);
+        return (bytes_written == -1) ? -errno : bytes_written;
+    }
+
     BufferArg bufArg(bufPtr, nbytes);
     bufArg.copyIn(SETranslatingPortProxy(tc));
 
@@ -2259,6 +2335,7 @@ execveFunc(SyscallDesc *desc, ThreadContext *tc,
     pp->cwd.assign(p->tgtCwd);
     pp->system = p->system;
     pp->release = p->release;
+    pp->async_io_threads = p->asyncIO ? p->asyncIO->numThreads() : 0;
     /**
      * Prevent process object creation with identical PIDs (which will trip
      * a fatal check in Process constructor). The execve call is supposed to
@@ -2267,8 +2344,10 @@ execveFunc(SyscallDesc *desc, ThreadContext *tc,
      * the process object in the simulator, we create a new process object
      * and bind to the previous process' thread below (hijacking the thread).
      */
+    std::unique_lock<std::recursive_mutex> pids_lock(p->system->processLock);
     p->system->PIDs.erase(p->pid());
     Process *new_p = pp->create();
+    pids_lock.unlock();
     // TODO: there is no way to know when the Process SimObject is done with
     // the params pointer. Both the params pointer (pp) and the process
     // pointer (p) are normally managed in python and are never cleaned up.
@@ -2598,6 +2677,8 @@ selectFunc(SyscallDesc *desc, ThreadContext *tc, int nfds,
              * signal would break the poll out of the retry cycle and try to
              * return the signal interrupt instead.
              */
+            std::lock_guard<std::recursive_mutex> lock(
+                    tc->getSystemPtr()->processLock);
             for (auto sig : tc->getSystemPtr()->signalList)
                 if (sig.receiver == p)
                     return -EINTR;
@@ -2662,6 +2743,15 @@ readFunc(SyscallDesc *desc, ThreadContext *tc,
         && !(hbfdp->getFlags() & OS::TGT_O_NONBLOCK))
         return SyscallReturn::retry();
 
+    if (p->asyncIO && isRegularFile(sim_fd))
+        return asyncFileSeqIO(tc, sim_fd, buf_ptr, nbytes, true);
+
+    std::vector<struct iovec> iov;
+    if (hostBuffer(tc, buf_ptr, nbytes, true, iov)) {
+        int bytes_read = readv(sim_fd, iov.data(), iov.size());
+        return (bytes_read == -1) ? -errno : bytes_read;
+    }
+
     BufferArg buf_arg(buf_ptr, nbytes);
     int bytes_read = read(sim_fd, buf_arg.bufferPtr(), nbytes);
 
@@ -2683,9 +2773,6 @@ writeFunc(SyscallDesc *desc, ThreadContext *tc,
         return -EBADF;
     int sim_fd = hbfdp->getSimFD();
 
-    BufferArg buf_arg(buf_ptr, nbytes);
-    buf_arg.copyIn(SETranslatingPortProxy(tc));
-
     struct pollfd pfd;
     pfd.fd = sim_fd;
     pfd.events = POLLOUT;
@@ -2702,7 +2789,20 @@ writeFunc(SyscallDesc *desc, ThreadContext *tc,
             return SyscallReturn::retry();
     }
 
-    int bytes_written = write(sim_fd, buf_arg.bufferPtr(), nbytes);
+    if (p->asyncIO && isRegularFile(sim_fd) &&
+            !(fcntl(sim_fd, F_GETFL) & O_APPEND)) {
+        return asyncFileSeqIO(tc, sim_fd, buf_ptr, nbytes, false);
+    }
+
+    int bytes_written;
+    std::vector<struct iovec> iov;
+    if (hostBuffer(tc, buf_ptr, nbytes, false, iov)) {
+        bytes_written = writev(sim_fd, iov.data(), iov.size());
+    } else {
+        BufferArg buf_arg(buf_ptr, nbytes);
+        buf_arg.copyIn(SETranslatingPortProxy(tc));
+        bytes_written = write(sim_fd, buf_arg.bufferPtr(), nbytes);
+    }
 
     if (bytes_written != -1)
         fsync(sim_fd);
@@ -2731,6 +2831,7 @@ wait4Func(SyscallDesc *desc, ThreadContext *tc,
      * call.
      */
     System *sysh = tc->getSystemPtr();
+    std::lock_guard<std::recursive_mutex> lock(sysh->processLock);
     std::list<BasicSignal>::iterator iter;
     for (iter=sysh->signalList.begin(); iter!=sysh->signalList.end(); iter++) {
         if (iter->receiver == p) {
@@ -42,6 +42,7 @@
 #ifndef __SYSTEM_HH__
 #define __SYSTEM_HH__
 
+#include <mutex>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -606,6 +607,13 @@ class System : public SimObject, public PCEventScope
     // receiver will delete the signal upon reception.
     std::list<BasicSignal> signalList;
 
+    /**
+     * Serializes the accesses to PIDs and signalList by processes running
+     * on different event queues. It is recursive so that process creation
+     * can be done while holding it.
+     */
+    std::recursive_mutex processLock;
+
     // Used by syscall-emulation mode. This member contains paths which need
     // to be redirected to the faux-filesystem (a duplicate filesystem
     // intended to replace certain files on the host filesystem).
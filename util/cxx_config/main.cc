@@ -44,7 +44,8 @@
  *  without carrying the integration cost of the fully-featured
  *  configuration system.
  *
- *  This file contains a demonstration main using CxxConfigManager.
+ *  This file contains a demonstration main using CxxSimulation and
+ *  CxxConfigManager.
  *  Build with something like:
  *
  *      scons --without-python build/ARM/libgem5_opt.so
@@ -63,12 +64,9 @@
 #include "base/trace.hh"
 #include "cpu/base.hh"
 #include "sim/cxx_config_ini.hh"
+#include "sim/cxx_config_snapshot.hh"
 #include "sim/cxx_manager.hh"
-#include "sim/init_signals.hh"
-#include "sim/serialize.hh"
-#include "sim/sim_events.hh"
-#include "sim/simulate.hh"
-#include "sim/stat_control.hh"
+#include "sim/cxx_simulation.hh"
 #include "sim/system.hh"
 #include "stats.hh"
 
@@ -80,6 +78,13 @@ usage(const std::string &prog_name)
     std::cerr << "Usage: " << prog_name << (
         " <config-file.ini> [ <option> ]\n\n"
         "OPTIONS:\n"
+        "    -S <snapshot>                -- load the config from a snapshot"
+        " of\n"
+        "                                    config-file.ini, writing it"
+        " first if\n"
+        "                                    it is missing or stale (must"
+        " be the\n"
+        "                                    first option)\n"
         "    -p <object> <param> <value>  -- set a parameter\n"
         "    -v <object> <param> <values> -- set a vector parameter from"
         " a comma\n"
@@ -108,30 +113,56 @@ main(int argc, char **argv)
     if (argc == 1)
         usage(prog_name);
 
-    initSignals();
-
-    setClockFrequency(1000000000000);
-    fixClockFrequency();
-    curEventQueue(getEventQueue(0));
-
-    statistics::initSimStats();
-    statistics::registerHandlers(CxxConfig::statsReset, CxxConfig::statsDump);
+    CxxSimulation::initialize(1000000000000, CxxConfig::statsReset,
+        CxxConfig::statsDump);
 
     Trace::enable();
     setDebugFlag("Terminal");
     // setDebugFlag("CxxConfig");
 
     const std::string config_file(argv[arg_ptr]);
+    arg_ptr++;
 
-    CxxConfigFileBase *conf = new CxxIniFile();
+    std::string snapshot_file = "";
+    if (argc - arg_ptr >= 2 && std::string(argv[arg_ptr]) == "-S") {
+        snapshot_file = argv[arg_ptr + 1];
+        arg_ptr += 2;
+    }
 
-    if (!conf->load(config_file.c_str())) {
-        std::cerr << "Can't open config file: " << config_file << '\n';
-        return EXIT_FAILURE;
+    CxxConfigFileBase *conf = NULL;
+    uint64_t config_hash = 0;
+
+    /* Use the snapshot if it was made from this exact config file,
+     *  otherwise fall back to the .ini and (re)write the snapshot */
+    if (snapshot_file != "") {
+        config_hash = CxxConfigSnapshot::hashFile(config_file);
+
+        CxxConfigSnapshot *snapshot = new CxxConfigSnapshot();
+        if (config_hash != 0 && snapshot->load(snapshot_file) &&
+            snapshot->getSourceHash() == config_hash) {
+            conf = snapshot;
+        } else {
+            delete snapshot;
+        }
     }
-    arg_ptr++;
 
-    CxxConfigManager *config_manager = new CxxConfigManager(*conf);
+    if (!conf) {
+        conf = new CxxIniFile();
+
+        if (!conf->load(config_file.c_str())) {
+            std::cerr << "Can't open config file: " << config_file << '\n';
+            return EXIT_FAILURE;
+        }
+
+        if (snapshot_file != "" &&
+            !CxxConfigSnapshot::write(*conf, snapshot_file, config_hash)) {
+            std::cerr << "Can't write config snapshot: " << snapshot_file
+                << '\n';
+        }
+    }
+
+    CxxSimulation *simulation = new CxxSimulation(*conf);
+    CxxConfigManager *config_manager = &simulation->getManager();
 
     bool checkpoint_restore = false;
     bool checkpoint_save = false;
@@ -207,14 +238,15 @@ main(int argc, char **argv)
         return EXIT_FAILURE;
     }
 
-    CxxConfig::statsEnable();
     getEventQueue(0)->dump();
 
     try {
-        config_manager->instantiate();
-        if (!checkpoint_restore) {
-            config_manager->initState();
-            config_manager->startup();
+        if (checkpoint_restore) {
+            std::cerr << "Restoring checkpoint\n";
+            simulation->restore(checkpoint_dir);
+            std::cerr << "Restored from checkpoint\n";
+        } else {
+            simulation->instantiate();
         }
     } catch (CxxConfigManager::Exception &e) {
         std::cerr << "Config problem in sim object " << e.name
@@ -223,55 +255,23 @@ main(int argc, char **argv)
         return EXIT_FAILURE;
     }
 
-    GlobalSimLoopExitEvent *exit_event = NULL;
+    CxxSimulation::ExitStatus exit_status;
 
     if (checkpoint_save) {
-        exit_event = simulate(pre_run_time);
-
-        unsigned int drain_count = 1;
-        do {
-            drain_count = config_manager->drain();
+        exit_status = simulation->simulateFor(pre_run_time);
 
-            std::cerr << "Draining " << drain_count << '\n';
-
-            if (drain_count > 0) {
-                exit_event = simulate();
-            }
-        } while (drain_count > 0);
-
-        std::cerr << "Simulation stop at tick " << curTick()
-            << ", cause: " << exit_event->getCause() << '\n';
+        std::cerr << "Simulation stop at tick " << exit_status.when
+            << ", cause: " << exit_status.cause << '\n';
 
         std::cerr << "Checkpointing\n";
 
-        /* FIXME, this should really be serialising just for
-         *  config_manager rather than using serializeAll's ugly
-         *  SimObject static object list */
-        SimObject::serializeAll(checkpoint_dir);
+        simulation->checkpoint(checkpoint_dir);
 
         std::cerr << "Completed checkpoint\n";
-
-        config_manager->drainResume();
-    }
-
-    if (checkpoint_restore) {
-        std::cerr << "Restoring checkpoint\n";
-
-        SimObject::setSimObjectResolver(
-            &config_manager->getSimObjectResolver());
-        CheckpointIn *checkpoint = new CheckpointIn(checkpoint_dir);
-
-        DrainManager::instance().preCheckpointRestore();
-        config_manager->loadState(*checkpoint);
-        config_manager->startup();
-
-        config_manager->drainResume();
-
-        std::cerr << "Restored from checkpoint\n";
     }
 
     if (switch_cpus) {
-        exit_event = simulate(pre_switch_time);
+        simulation->simulateFor(pre_switch_time);
 
         std::cerr << "Switching CPU\n";
 
@@ -287,7 +287,7 @@ main(int argc, char **argv)
             std::cerr << "Draining " << drain_count << '\n';
 
             if (drain_count > 0) {
-                exit_event = simulate();
+                simulation->simulateUntil();
             }
         } while (drain_count > 0);
 
@@ -299,10 +299,10 @@ main(int argc, char **argv)
         std::cerr << "Switched CPU\n";
     }
 
-    exit_event = simulate();
+    exit_status = simulation->simulateUntil();
 
-    std::cerr << "Exit at tick " << curTick()
-        << ", cause: " << exit_event->getCause() << '\n';
+    std::cerr << "Exit at tick " << exit_status.when
+        << ", cause: " << exit_status.cause << '\n';
 
     getEventQueue(0)->dump();
 
@@ -310,7 +310,7 @@ main(int argc, char **argv)
     config_manager->deleteObjects();
 #endif
 
-    delete config_manager;
+    delete simulation;
 
     return EXIT_SUCCESS;
 }
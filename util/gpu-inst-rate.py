@@ -0,0 +1,106 @@
+#! /usr/bin/env python3
+
+# Copyright (c) 2026 The gem5 Authors
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# This script measures how fast gem5 simulates GPU kernels. It runs an
+# application with the apu_se.py example script (or reads the stats of a
+# previous run) and reports the number of GPU instructions executed by
+# the compute units per second of host time, e.g.:
+#
+#   util/gpu-inst-rate.py -b build/VEGA_X86/gem5.opt -- -n 3 -c square
+#
+# Comparing the rate of two gem5 binaries on the same kernel shows the
+# effect of changes to the GPU model or the instruction implementations.
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+parser = argparse.ArgumentParser()
+group = parser.add_mutually_exclusive_group(required=True)
+group.add_argument("-b", "--binary", help="gem5 binary to run apu_se.py with")
+group.add_argument("-s", "--stats", help="stats.txt of a previous run")
+parser.add_argument(
+    "--config",
+    default=os.path.join(
+        os.path.dirname(__file__), os.pardir, "configs/example/apu_se.py"
+    ),
+    help="configuration script to run",
+)
+parser.add_argument(
+    "config_args",
+    nargs=argparse.REMAINDER,
+    help="arguments of the configuration script, after --",
+)
+
+args = parser.parse_args()
+
+
+def parse_stats(path):
+    """Return the GPU instruction count and host time of the last stats
+    dump of a stats file."""
+    insts = None
+    seconds = None
+    with open(path) as stats:
+        for line in stats:
+            if line.startswith("---------- Begin Simulation Statistics"):
+                insts = 0
+                seconds = None
+                continue
+            fields = line.split()
+            if len(fields) < 2:
+                continue
+            if re.search(r"\.CUs\d*\.numInstrExecuted$", fields[0]):
+                insts += int(fields[1])
+            elif fields[0] == "hostSeconds":
+                seconds = float(fields[1])
+    if not insts or not seconds:
+        sys.exit(f"No GPU instructions or host time found in {path}")
+    return insts, seconds
+
+
+if args.binary:
+    config_args = args.config_args
+    if config_args and config_args[0] == "--":
+        config_args = config_args[1:]
+    outdir = tempfile.mkdtemp(prefix="gpu-inst-rate-")
+    status = subprocess.call(
+        [args.binary, "-d", outdir, args.config] + config_args
+    )
+    if status != 0:
+        sys.exit(f"Error: {args.binary} failed, see {outdir}")
+    stats_path = os.path.join(outdir, "stats.txt")
+else:
+    stats_path = args.stats
+
+insts, seconds = parse_stats(stats_path)
+print(f"GPU instructions: {insts}")
+print(f"Host seconds: {seconds:.2f}")
+print(f"GPU instructions per host second: {insts / seconds:.0f}")